@@ -33,10 +33,6 @@ constexpr uint32_t TIMEOUT_MS = 300; // ms
 static iSYSTargetList_t targetList;
 
 // ---------------------- Helper Functions ---------------------- //
-void flushSerial2() {
-  while (Serial2.available()) { Serial2.read(); }
-}
-
 // Utility to print a target list already filled by getTargetList16/32
 void printTargetList(const char* label) {
   Serial.println(label);
@@ -66,8 +62,6 @@ void setup() {
 
   // Initialize Serial2 for radar
   Serial2.begin(115200, SERIAL_8N1, 16, 17);
-
-  flushSerial2();
   delay(100);
 
   // ---------------------- Configuration & Acquisition ---------------------- //
@@ -107,8 +101,6 @@ void setup() {
 }
 
 void loop() {
-  flushSerial2();
-
   // First: getTargetList16 (compact)
   {
     iSYSResult_t res16 = radar.getTargetList16(&targetList, DESTINATION_ADDRESS, TIMEOUT_MS, ISYS_OUTPUT_1);
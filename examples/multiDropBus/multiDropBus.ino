@@ -0,0 +1,90 @@
+/*
+  iSYS4001 Radar Sensor — Several Sensors on One UART (Multi-Drop Bus)
+  -------------------------------------------------------------------
+  This example shows how to read target lists from several sensors that share
+  one RS-485 line, using the iSYS4001Bus round-robin scheduler.
+
+  What this sketch does:
+  - Initializes UART (Serial2) connected to the RS-485 transceiver.
+  - (Setup) Starts acquisition on every sensor, registers them with the scheduler and starts it.
+  - (Loop) Calls bus.poll(); every completed request prints that sensor's target count.
+    Every 5 seconds the per-device statistics are printed.
+
+  How offline sensors are handled:
+  - After 3 consecutive failures a sensor is marked offline.
+  - Offline sensors are only probed every 10 rounds with a short probe timeout,
+    so the other sensors keep their update rate.
+
+  Wiring (ESP32 example):
+    - RX (GPIO16) ←→ RS-485 transceiver RO
+    - TX (GPIO17) ←→ RS-485 transceiver DI
+    - GND shared
+
+  Notes:
+    - Every sensor needs a unique address; see iSYS_setDeviceAddress().
+    - Adjust SENSOR_ADDRESSES to match your installation.
+*/
+
+#include "iSYS4001Bus.h"
+
+// Bus scheduler and configuration
+iSYS4001Bus bus(Serial2, 115200);
+constexpr uint8_t SENSOR_COUNT = 4;
+constexpr uint8_t SENSOR_ADDRESSES[SENSOR_COUNT] = {0x80, 0x81, 0x82, 0x83};
+constexpr uint32_t TIMEOUT_MS = 300;      // ms, online sensors
+constexpr uint32_t PROBE_TIMEOUT_MS = 100; // ms, offline sensors
+static iSYSTargetList_t targetLists[SENSOR_COUNT];
+
+static uint32_t lastStats = 0;
+
+// ---------------------- Helper Functions ---------------------- //
+void printStats() {
+  for (uint8_t i = 0; i < bus.getDeviceCount(); i++) {
+    const iSYSBusDeviceStats_t *stats = bus.getDeviceStats(i);
+    Serial.printf("  0x%02X %-7s requests:%lu responses:%lu timeouts:%lu errors:%lu latency:%lu ms\n",
+                  stats->address,
+                  stats->online ? "online" : "offline",
+                  (unsigned long)stats->requests,
+                  (unsigned long)stats->responses,
+                  (unsigned long)stats->timeouts,
+                  (unsigned long)stats->errors,
+                  (unsigned long)stats->lastLatency);
+  }
+}
+
+// ---------------------- Arduino Setup & Loop ---------------------- //
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) { delay(10); }
+
+  // Initialize Serial2 for the RS-485 line
+  Serial2.begin(115200, SERIAL_8N1, 16, 17);
+  delay(100);
+
+  // Start acquisition on every sensor (blocking calls, before the scheduler runs)
+  for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+    iSYSResult_t res = bus.getRadar().iSYS_startAcquisition(SENSOR_ADDRESSES[i], TIMEOUT_MS);
+    if (res != ERR_OK) {
+      Serial.printf("[WARN] iSYS_startAcquisition failed for 0x%02X: %d\n", SENSOR_ADDRESSES[i], res);
+    }
+    bus.addDevice(SENSOR_ADDRESSES[i], &targetLists[i], ISYS_OUTPUT_1);
+  }
+
+  bus.setTimeouts(TIMEOUT_MS, PROBE_TIMEOUT_MS);
+  bus.start();
+}
+
+void loop() {
+  uint8_t device;
+  if (bus.poll(&device)) {
+    const iSYSBusDeviceStats_t *stats = bus.getDeviceStats(device);
+    if (stats->lastResult == ERR_OK) {
+      Serial.printf("0x%02X: %u targets\n", stats->address, targetLists[device].nrOfTargets);
+    }
+  }
+
+  if (millis() - lastStats >= 5000) {
+    lastStats = millis();
+    printStats();
+  }
+}
@@ -0,0 +1,92 @@
+/*
+  iSYS4001 Radar Sensor — Non-Blocking Target List Polling
+  --------------------------------------------------------
+  This example shows how to read target lists without stalling loop() while
+  the radar answers.
+
+  What this sketch does:
+  - Initializes UART (Serial2) to talk to the radar.
+  - (Setup) Starts acquisition in the default blocking mode, then switches the library to non-blocking mode.
+  - (Loop) Starts a getTargetList32 request, keeps doing other work (here: counting loop iterations),
+    and calls radar.poll() until the transaction completes.
+
+  How non-blocking mode works:
+  - Every API call sends its request and returns ERR_TRANSACTION_PENDING immediately.
+  - radar.poll() collects whatever bytes have arrived and never waits.
+  - When poll() returns ISYS_TRANSACTION_COMPLETE, getTransactionResult() holds the
+    same result code the blocking call would have returned.
+  - Only one request can be in flight; a second call returns ERR_TRANSACTION_BUSY.
+
+  Wiring (ESP32 example):
+    - RX (GPIO16) ←→ Radar TX
+    - TX (GPIO17) ←→ Radar RX
+    - GND shared
+
+  Notes:
+    - The target list passed to getTargetList32 is filled when the transaction completes,
+      so it must stay valid (global/static) until then.
+    - Adjust DESTINATION_ADDRESS if your sensor uses a different address.
+*/
+
+#include "iSYS4001.h"
+
+// Radar object and configuration
+iSYS4001 radar(Serial2, 115200);
+constexpr uint8_t DESTINATION_ADDRESS = 0x80;
+constexpr uint32_t TIMEOUT_MS = 300;       // ms
+constexpr uint32_t POLL_INTERVAL_MS = 100; // request a new list every 100 ms
+static iSYSTargetList_t targetList;
+
+static uint32_t lastRequest = 0;
+static uint32_t idleLoops = 0;
+static bool waiting = false;
+
+// ---------------------- Arduino Setup & Loop ---------------------- //
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) { delay(10); }
+
+  // Initialize Serial2 for radar
+  Serial2.begin(115200, SERIAL_8N1, 16, 17);
+  delay(100);
+
+  // Configuration calls can stay blocking; switch modes once setup is done
+  iSYSResult_t res = radar.iSYS_startAcquisition(DESTINATION_ADDRESS, TIMEOUT_MS);
+  if (res != ERR_OK) {
+    Serial.print("[WARN] iSYS_startAcquisition failed: ");
+    Serial.println(res);
+  }
+
+  radar.setNonBlocking(true);
+}
+
+void loop() {
+  // Start a new request when the radar is free and the poll interval has elapsed
+  if (!waiting && (millis() - lastRequest) >= POLL_INTERVAL_MS) {
+    lastRequest = millis();
+    idleLoops = 0;
+    waiting = (radar.getTargetList32(&targetList, DESTINATION_ADDRESS, TIMEOUT_MS, ISYS_OUTPUT_1) == ERR_TRANSACTION_PENDING);
+  }
+
+  // Advance the pending transaction; returns immediately
+  if (waiting && radar.poll() == ISYS_TRANSACTION_COMPLETE) {
+    waiting = false;
+    iSYSResult_t res = radar.getTransactionResult();
+    if (res == ERR_OK) {
+      Serial.printf("Targets: %u (loop ran %lu times while waiting)\n", targetList.nrOfTargets, (unsigned long)idleLoops);
+      for (uint16_t i = 0; i < targetList.nrOfTargets && i < MAX_TARGETS; i++) {
+        Serial.printf("  #%u Range:%.2f m Velocity:%.2f m/s Signal:%.2f dB\n",
+                      i + 1,
+                      targetList.targets[i].range,
+                      targetList.targets[i].velocity,
+                      targetList.targets[i].signal);
+      }
+    } else {
+      Serial.print("getTargetList32 failed: ");
+      Serial.println(res);
+    }
+  }
+
+  // Other application work keeps running while the radar answers
+  idleLoops++;
+}
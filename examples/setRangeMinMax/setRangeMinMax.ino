@@ -50,14 +50,6 @@ constexpr uint16_t OUTPUT1_MAX_RANGE_M = 50; // set as needed
 static iSYSTargetList_t gTargetList;
 
 // ---------------------- Helpers ----------------------
-static void flushRadarUart()
-{
-    while (Serial2.available())
-    {
-        Serial2.read();
-    }
-}
-
 static const char *resultToStr(iSYSResult_t r)
 {
     switch (r)
@@ -134,8 +126,6 @@ void setup()
     // Route library debug to USB Serial for visibility
     radar.setDebug(Serial, true);
 
-    // Clear any stale bytes before sending commands
-    flushRadarUart();
     delay(100);
 
     Serial.println("=== iSYS4001 setup: configuring device ===");
@@ -216,9 +206,6 @@ void setup()
 
 void loop()
 {
-    // Keep the UART clean between request/response cycles
-    flushRadarUart();
-
     // Request compact 16-bit target list on Output 1
     iSYSResult_t res16 = radar.getTargetList16(&gTargetList, DESTINATION_ADDRESS, TIMEOUT_MS, ISYS_OUTPUT_1);
     if (res16 == ERR_OK)
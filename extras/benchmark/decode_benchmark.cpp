@@ -0,0 +1,224 @@
+/*
+ * Micro-benchmark for the target list decoder
+ *
+ * Measures decodeTargetList() (frame checks + decodeTargetFrame()) on synthetic
+ * 16-bit and 32-bit frames with 0, 1, 8, 16 and MAX_TARGETS targets and on the
+ * clipping frame. Every case is timed in batches for at least --time seconds;
+ * the fastest of --repeat runs is reported, which filters out scheduler noise.
+ * --arrays decodes into iSYSTargetArrays_t, --fixed into iSYSTargetListFixed_t
+ * instead of iSYSTargetList_t. --decoder picks the record kernel (see
+ * iSYSTargetDecoder.h), so the SIMD kernels can be compared against the scalar one.
+ * --zero-fill clears the entries past nrOfTargets on every decode, as the driver
+ * did before setTargetListZeroFill() existed.
+ *
+ *   $ ./isys4001_decode_benchmark --decoder scalar
+ *   decoder scalar
+ *   format  targets   ns/frame  ns/target      frames/s
+ *   16-bit        0       ...
+ *
+ * Record the table before changing the decode loop or one of the list types, and
+ * compare against it afterwards on the same machine and build type.
+ */
+
+#include "iSYS4001.h"
+#include "iSYSBenchmarkFrames.h"
+#include "iSYSTargetDecoder.h"
+
+#include <getopt.h>
+#include <stdlib.h>
+
+/**
+ * @brief Transport that never sends or receives; the benchmark only uses the decoder
+ */
+class iSYSNullTransport : public iSYSTransport
+{
+public:
+    size_t write(const uint8_t *, size_t length) { return length; }
+    size_t read(uint8_t *, size_t) { return 0; }
+    int available() { return 0; }
+    void flush() {}
+    uint32_t millis() { return (uint32_t)(iSYSMonotonicNs() / 1000000u); }
+    uint32_t micros() { return (uint32_t)(iSYSMonotonicNs() / 1000u); }
+};
+
+/**
+ * @brief Time one case
+ *
+ * @tparam TargetList iSYSTargetList_t, iSYSTargetArrays_t or iSYSTargetListFixed_t
+ *
+ * @return double Fastest ns per decoded frame over all repeats
+ */
+template <typename TargetList>
+static double runCase(iSYS4001 &radar, const uint8_t *frame, uint16_t length, double minSeconds, unsigned repeats)
+{
+    static TargetList targetList;
+    double best = 0.0;
+
+    // Calibrate a batch size that takes about a millisecond so clock reads do not matter
+    uint32_t batch = 1;
+    for (;;)
+    {
+        const uint64_t start = iSYSMonotonicNs();
+        for (uint32_t i = 0; i < batch; i++)
+        {
+            radar.decodeTargetList(frame, length, &targetList);
+        }
+        if (iSYSMonotonicNs() - start >= 1000000u || batch >= (1u << 30))
+        {
+            break;
+        }
+        batch *= 2;
+    }
+
+    for (unsigned repeat = 0; repeat < repeats; repeat++)
+    {
+        uint64_t frames = 0;
+        const uint64_t start = iSYSMonotonicNs();
+        uint64_t elapsed = 0;
+
+        do
+        {
+            for (uint32_t i = 0; i < batch; i++)
+            {
+                if (radar.decodeTargetList(frame, length, &targetList) != ERR_OK)
+                {
+                    fprintf(stderr, "decodeTargetList failed\n");
+                    exit(1);
+                }
+            }
+            frames += batch;
+            elapsed = iSYSMonotonicNs() - start;
+        } while ((double)elapsed * 1E-9 < minSeconds);
+
+        const double nsPerFrame = (double)elapsed / (double)frames;
+        if (repeat == 0 || nsPerFrame < best)
+        {
+            best = nsPerFrame;
+        }
+    }
+
+    return best;
+}
+
+static void usage(const char *program)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --time SECONDS    minimum run time per case and repeat (default 0.2)\n"
+            "  --repeat N        runs per case, the fastest is reported (default 5)\n"
+            "  --arrays          decode into iSYSTargetArrays_t (one array per field)\n"
+            "  --fixed           decode into iSYSTargetListFixed_t (integer units)\n"
+            "  --decoder NAME    record kernel: auto, scalar, sse4.1, avx2 or neon (default auto)\n"
+            "  --zero-fill       clear target entries past nrOfTargets (setTargetListZeroFill())\n",
+            program);
+}
+
+int main(int argc, char **argv)
+{
+    double minSeconds = 0.2;
+    unsigned repeats = 5;
+    bool arrays = false;
+    bool fixed = false;
+    bool zeroFill = false;
+    iSYSTargetDecoder_t decoder = ISYS_DECODER_AUTO;
+    bool decoderKnown = true;
+
+    static const struct option options[] = {
+        {"time", required_argument, nullptr, 't'},
+        {"repeat", required_argument, nullptr, 'r'},
+        {"arrays", no_argument, nullptr, 'a'},
+        {"fixed", no_argument, nullptr, 'x'},
+        {"decoder", required_argument, nullptr, 'd'},
+        {"zero-fill", no_argument, nullptr, 'z'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0}};
+
+    int option;
+    while ((option = getopt_long(argc, argv, "h", options, nullptr)) != -1)
+    {
+        switch (option)
+        {
+        case 't':
+            minSeconds = strtod(optarg, nullptr);
+            break;
+        case 'r':
+            repeats = (unsigned)strtoul(optarg, nullptr, 0);
+            break;
+        case 'a':
+            arrays = true;
+            break;
+        case 'x':
+            fixed = true;
+            break;
+        case 'd':
+            decoderKnown = false;
+            for (uint8_t d = ISYS_DECODER_AUTO; d <= ISYS_DECODER_NEON; d++)
+            {
+                if (strcmp(optarg, iSYSTargetDecoderName((iSYSTargetDecoder_t)d)) == 0)
+                {
+                    decoder = (iSYSTargetDecoder_t)d;
+                    decoderKnown = true;
+                }
+            }
+            break;
+        case 'z':
+            zeroFill = true;
+            break;
+        default:
+            usage(argv[0]);
+            return (option == 'h') ? 0 : 2;
+        }
+    }
+
+    if (repeats == 0 || (arrays && fixed) || !decoderKnown)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (!iSYSSetTargetDecoder(decoder))
+    {
+        fprintf(stderr, "%s: decoder not available on this build or CPU\n", argv[0]);
+        return 2;
+    }
+
+    static const uint8_t counts[] = {0, 1, 8, 16, MAX_TARGETS, 0xFF};
+    static const uint8_t bitrates[] = {16, 32};
+
+    iSYSNullTransport transport;
+    iSYS4001 radar(transport);
+    radar.setTargetListZeroFill(zeroFill);
+    uint8_t frame[ISYS_MAX_FRAME_LENGTH];
+
+    printf("decoder %s\n", iSYSTargetDecoderName(iSYSGetTargetDecoder()));
+    printf("%-7s %8s %10s %10s %13s\n", "format", "targets", "ns/frame", "ns/target", "frames/s");
+
+    for (uint8_t b = 0; b < sizeof(bitrates); b++)
+    {
+        for (uint8_t c = 0; c < sizeof(counts); c++)
+        {
+            const uint8_t nrOfTargets = counts[c];
+            const uint16_t length = iSYSBuildTargetListFrame(frame, bitrates[b], nrOfTargets);
+            double nsPerFrame;
+            if (arrays)
+                nsPerFrame = runCase<iSYSTargetArrays_t>(radar, frame, length, minSeconds, repeats);
+            else if (fixed)
+                nsPerFrame = runCase<iSYSTargetListFixed_t>(radar, frame, length, minSeconds, repeats);
+            else
+                nsPerFrame = runCase<iSYSTargetList_t>(radar, frame, length, minSeconds, repeats);
+
+            char targets[8];
+            char perTarget[16];
+            snprintf(targets, sizeof(targets), (nrOfTargets == 0xFF) ? "clip" : "%u", (unsigned)nrOfTargets);
+            if (nrOfTargets == 0 || nrOfTargets == 0xFF)
+                snprintf(perTarget, sizeof(perTarget), "-");
+            else
+                snprintf(perTarget, sizeof(perTarget), "%.2f", nsPerFrame / nrOfTargets);
+
+            printf("%2u-bit  %8s %10.1f %10s %13.0f\n", (unsigned)bitrates[b], targets, nsPerFrame, perTarget, 1E9 / nsPerFrame);
+            fflush(stdout);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+#ifndef ISYSBENCHMARKFRAMES_H
+#define ISYSBENCHMARKFRAMES_H
+
+#include "iSYS4001.h"
+
+#include <time.h>
+
+/**
+ * @brief Monotonic clock for the benchmarks
+ *
+ * @return uint64_t Nanoseconds since an arbitrary start
+ */
+static inline uint64_t iSYSMonotonicNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Deterministic pseudo-random bytes so every run uses the same frames
+ */
+static inline uint8_t iSYSBenchmarkRandomByte()
+{
+    static uint32_t state = 0x12345678u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return (uint8_t)(state >> 24);
+}
+
+/**
+ * @brief Build a target list frame as the sensor sends it
+ *
+ * @param frame Destination, at least ISYS_MAX_FRAME_LENGTH bytes
+ * @param bitrate 16 (SD2 frame, 7 bytes per target) or 32 (long frame, 14 bytes per target)
+ * @param nrOfTargets Target count, or 0xFF for a clipping frame
+ *
+ * @return uint16_t Frame length
+ *
+ * @note The frame answers a request from the master to device 0x80 for ISYS_OUTPUT_1.
+ */
+static inline uint16_t iSYSBuildTargetListFrame(uint8_t *frame, uint8_t bitrate, uint8_t nrOfTargets)
+{
+    const uint8_t records = (nrOfTargets == 0xFF) ? 0 : nrOfTargets;
+    const uint8_t bytesPerTarget = (bitrate == 32) ? 14 : 7;
+    uint16_t index = 0;
+    uint8_t fcsStart;
+
+    if (bitrate == 32)
+    {
+        frame[index++] = 0xA2;
+        fcsStart = 1;
+    }
+    else
+    {
+        const uint8_t le = (uint8_t)(5 + records * bytesPerTarget);
+        frame[index++] = ISYS_FRAME_SD2;
+        frame[index++] = le;
+        frame[index++] = le;
+        frame[index++] = ISYS_FRAME_SD2;
+        fcsStart = 4;
+    }
+
+    frame[index++] = ISYS_FRAME_MASTER_ADDRESS;
+    frame[index++] = 0x80;
+    frame[index++] = ISYS_FRAME_FC_TARGET_LIST;
+    frame[index++] = ISYS_OUTPUT_1;
+    frame[index++] = nrOfTargets;
+
+    for (uint16_t i = 0; i < (uint16_t)records * bytesPerTarget; i++)
+    {
+        frame[index++] = iSYSBenchmarkRandomByte();
+    }
+
+    uint8_t fcs = 0;
+    for (uint16_t i = fcsStart; i < index; i++)
+    {
+        fcs += frame[i];
+    }
+    frame[index++] = fcs;
+    frame[index++] = ISYS_FRAME_END;
+
+    return index;
+}
+
+#endif
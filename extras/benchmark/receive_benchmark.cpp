@@ -0,0 +1,232 @@
+/*
+ * Micro-benchmark for the target list receive path
+ *
+ * Measures getTargetList16/32() end to end against a mock transport: request
+ * frame out, response drained through poll() and the frame parser, list decoded.
+ * The mock answers every request with a prebuilt frame, handed out at most --chunk
+ * bytes per available()/read() pair. --chunk 1 gives the driver one byte per call,
+ * the cost of the former per-byte read() loop; larger chunks show what the bulk
+ * read saves when the UART holds more than one byte. Every transport call is
+ * counted, since on ESP32 each one takes the UART driver lock.
+ *
+ *   $ ./isys4001_receive_benchmark
+ *   format  targets    chunk   ns/frame  calls/frame      frames/s
+ *   32-bit       35        1       ...
+ *
+ * Times are fastest of --repeat runs of at least --time seconds each. Without
+ * --chunk, chunks of 1, 8, 64 bytes and whole frames are measured.
+ */
+
+#include "iSYS4001.h"
+#include "iSYSBenchmarkFrames.h"
+
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Transport that answers every request with one prebuilt response
+ *
+ * Like a UART FIFO that never holds more than the chunk size: available() reports
+ * at most that many bytes and read() returns no more.
+ */
+class iSYSChunkedTransport : public iSYSTransport
+{
+public:
+    iSYSChunkedTransport() : _response(nullptr), _length(0), _position(0), _chunk(0), _calls(0) {}
+
+    void setResponse(const uint8_t *response, uint16_t length)
+    {
+        _response = response;
+        _length = length;
+        _position = length;
+    }
+
+    // 0 hands out the whole remaining response at once
+    void setChunk(uint16_t chunk) { _chunk = chunk; }
+
+    uint64_t calls() const { return _calls; }
+
+    size_t write(const uint8_t *, size_t length)
+    {
+        _position = 0;
+        return length;
+    }
+
+    size_t read(uint8_t *data, size_t length)
+    {
+        _calls++;
+        const size_t ready = readyBytes();
+        if (length > ready)
+        {
+            length = ready;
+        }
+        memcpy(data, &_response[_position], length);
+        _position += (uint16_t)length;
+        return length;
+    }
+
+    int available()
+    {
+        _calls++;
+        return (int)readyBytes();
+    }
+
+    void flush() {}
+    uint32_t millis() { return (uint32_t)(iSYSMonotonicNs() / 1000000u); }
+    uint32_t micros() { return (uint32_t)(iSYSMonotonicNs() / 1000u); }
+
+private:
+    const uint8_t *_response;
+    uint16_t _length;
+    uint16_t _position;
+    uint16_t _chunk;
+    uint64_t _calls;
+
+    size_t readyBytes() const
+    {
+        const uint16_t remaining = (uint16_t)(_length - _position);
+        return (_chunk == 0 || remaining < _chunk) ? remaining : _chunk;
+    }
+};
+
+/**
+ * @brief Time one case
+ *
+ * @param calls Receives the transport calls per frame
+ *
+ * @return double Fastest ns per received frame over all repeats
+ */
+static double runCase(iSYS4001 &radar, iSYSChunkedTransport &transport, uint8_t bitrate, double minSeconds, unsigned repeats, double *calls)
+{
+    static iSYSTargetList_t targetList;
+    double best = 0.0;
+
+    for (unsigned repeat = 0; repeat < repeats; repeat++)
+    {
+        uint64_t frames = 0;
+        const uint64_t firstCall = transport.calls();
+        const uint64_t start = iSYSMonotonicNs();
+        uint64_t elapsed = 0;
+
+        do
+        {
+            for (uint32_t i = 0; i < 256; i++)
+            {
+                const iSYSResult_t res = (bitrate == 32) ? radar.getTargetList32(&targetList, 0x80, 300)
+                                                         : radar.getTargetList16(&targetList, 0x80, 300);
+                if (res != ERR_OK)
+                {
+                    fprintf(stderr, "getTargetList%u failed: %d\n", (unsigned)bitrate, (int)res);
+                    exit(1);
+                }
+            }
+            frames += 256;
+            elapsed = iSYSMonotonicNs() - start;
+        } while ((double)elapsed * 1E-9 < minSeconds);
+
+        const double nsPerFrame = (double)elapsed / (double)frames;
+        if (repeat == 0 || nsPerFrame < best)
+        {
+            best = nsPerFrame;
+        }
+        *calls = (double)(transport.calls() - firstCall) / (double)frames;
+    }
+
+    return best;
+}
+
+static void usage(const char *program)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --time SECONDS    minimum run time per case and repeat (default 0.2)\n"
+            "  --repeat N        runs per case, the fastest is reported (default 5)\n"
+            "  --targets N       targets per frame, 0 to MAX_TARGETS (default MAX_TARGETS)\n"
+            "  --chunk N         bytes per available()/read(), 0 for whole frames\n"
+            "                    (default: 1, 8, 64 and 0)\n",
+            program);
+}
+
+int main(int argc, char **argv)
+{
+    double minSeconds = 0.2;
+    unsigned repeats = 5;
+    unsigned nrOfTargets = MAX_TARGETS;
+    long chunk = -1;
+
+    static const struct option options[] = {
+        {"time", required_argument, nullptr, 't'},
+        {"repeat", required_argument, nullptr, 'r'},
+        {"targets", required_argument, nullptr, 'n'},
+        {"chunk", required_argument, nullptr, 'c'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0}};
+
+    int option;
+    while ((option = getopt_long(argc, argv, "h", options, nullptr)) != -1)
+    {
+        switch (option)
+        {
+        case 't':
+            minSeconds = strtod(optarg, nullptr);
+            break;
+        case 'r':
+            repeats = (unsigned)strtoul(optarg, nullptr, 0);
+            break;
+        case 'n':
+            nrOfTargets = (unsigned)strtoul(optarg, nullptr, 0);
+            break;
+        case 'c':
+            chunk = strtol(optarg, nullptr, 0);
+            break;
+        default:
+            usage(argv[0]);
+            return (option == 'h') ? 0 : 2;
+        }
+    }
+
+    if (repeats == 0 || nrOfTargets > MAX_TARGETS || chunk < -1 || chunk > ISYS_MAX_FRAME_LENGTH)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    static const uint16_t defaultChunks[] = {1, 8, 64, 0};
+    static const uint8_t bitrates[] = {16, 32};
+    const uint16_t *chunks = defaultChunks;
+    uint8_t chunkCount = sizeof(defaultChunks) / sizeof(defaultChunks[0]);
+    uint16_t singleChunk;
+    if (chunk >= 0)
+    {
+        singleChunk = (uint16_t)chunk;
+        chunks = &singleChunk;
+        chunkCount = 1;
+    }
+
+    iSYSChunkedTransport transport;
+    iSYS4001 radar(transport);
+    uint8_t frame[ISYS_MAX_FRAME_LENGTH];
+
+    printf("%-7s %8s %8s %10s %12s %13s\n", "format", "targets", "chunk", "ns/frame", "calls/frame", "frames/s");
+
+    for (uint8_t b = 0; b < sizeof(bitrates); b++)
+    {
+        const uint16_t length = iSYSBuildTargetListFrame(frame, bitrates[b], (uint8_t)nrOfTargets);
+        transport.setResponse(frame, length);
+
+        for (uint8_t c = 0; c < chunkCount; c++)
+        {
+            transport.setChunk(chunks[c]);
+            double calls = 0.0;
+            const double nsPerFrame = runCase(radar, transport, bitrates[b], minSeconds, repeats, &calls);
+
+            char chunkName[8];
+            snprintf(chunkName, sizeof(chunkName), (chunks[c] == 0) ? "frame" : "%u", (unsigned)chunks[c]);
+            printf("%2u-bit  %8u %8s %10.1f %12.1f %13.0f\n", (unsigned)bitrates[b], nrOfTargets, chunkName, nsPerFrame, calls, 1E9 / nsPerFrame);
+            fflush(stdout);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+#include "iSYSCaptureReader.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Read size; a block holds thousands of target list records
+#define ISYS_CAPTURE_READER_BLOCK (1u << 20)
+
+/**
+ * @brief Constructor for the capture reader
+ */
+iSYSCaptureReader::iSYSCaptureReader()
+    : _file(nullptr), _buffer(nullptr), _start(0), _length(0), _eof(true), _truncated(false), _version(0),
+      _haveTime(false), _lastTimestamp(0), _time(0)
+{
+}
+
+/**
+ * @brief Destructor; closes the capture
+ */
+iSYSCaptureReader::~iSYSCaptureReader()
+{
+    close();
+}
+
+/**
+ * @brief Open a capture file and check its file header
+ *
+ * @param path Capture written by iSYS4001::setCapture()
+ *
+ * @return bool true on success, false if the file cannot be read or is not a capture
+ */
+bool iSYSCaptureReader::open(const char *path)
+{
+    close();
+
+    _file = fopen(path, "rb");
+    _buffer = (uint8_t *)malloc(ISYS_CAPTURE_READER_BLOCK);
+    if (_file == nullptr || _buffer == nullptr || !readHeader())
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Close the capture and release the buffer
+ */
+void iSYSCaptureReader::close()
+{
+    if (_file != nullptr)
+    {
+        fclose(_file);
+        _file = nullptr;
+    }
+    free(_buffer);
+    _buffer = nullptr;
+    _start = 0;
+    _length = 0;
+    _eof = true;
+}
+
+/**
+ * @brief Start reading again from the first record
+ *
+ * @return bool true on success, false if no capture is open
+ */
+bool iSYSCaptureReader::rewind()
+{
+    if (_file == nullptr || fseek(_file, 0, SEEK_SET) != 0)
+    {
+        return false;
+    }
+    return readHeader();
+}
+
+/**
+ * @brief Read the next block of the capture into the buffer
+ *
+ * Moves an incomplete record at the end of the buffer to the front and appends
+ * as much of the file as fits.
+ *
+ * @return bool true while buffered records remain, false at the end of the capture
+ */
+bool iSYSCaptureReader::fill()
+{
+    if (_file == nullptr)
+    {
+        return false;
+    }
+
+    if (_start > 0)
+    {
+        memmove(_buffer, _buffer + _start, _length - _start);
+        _length -= _start;
+        _start = 0;
+    }
+
+    if (!_eof)
+    {
+        size_t count = fread(_buffer + _length, 1, ISYS_CAPTURE_READER_BLOCK - _length, _file);
+        _length += count;
+        _eof = (_length < ISYS_CAPTURE_READER_BLOCK) && feof(_file);
+    }
+
+    return _length > 0;
+}
+
+/**
+ * @brief Get the next buffered record
+ *
+ * @param record Receives the decoded record header
+ * @param data Receives a pointer to the frame bytes; valid until the next fill()
+ *
+ * @return bool true if a record was returned, false if fill() must be called first
+ *
+ * @note An incomplete record at the end of the file is dropped and reported by truncated().
+ */
+bool iSYSCaptureReader::next(iSYSCaptureRecord_t *record, const uint8_t **data)
+{
+    const size_t remaining = _length - _start;
+    const uint8_t *header = _buffer + _start;
+    const uint16_t length = (remaining >= ISYS_CAPTURE_RECORD_HEADER_LENGTH) ? (uint16_t)(header[6] | (header[7] << 8)) : 0;
+
+    if (remaining < ISYS_CAPTURE_RECORD_HEADER_LENGTH || remaining < (size_t)ISYS_CAPTURE_RECORD_HEADER_LENGTH + length)
+    {
+        if (_eof && remaining > 0)
+        {
+            // The capture ends inside a record (device reset or full card while recording)
+            _truncated = true;
+            _start = _length;
+        }
+        return false;
+    }
+
+    record->timestamp = (uint32_t)header[0] | ((uint32_t)header[1] << 8) | ((uint32_t)header[2] << 16) | ((uint32_t)header[3] << 24);
+    record->direction = header[4];
+    record->address = header[5];
+    record->length = length;
+    *data = header + ISYS_CAPTURE_RECORD_HEADER_LENGTH;
+    _start += ISYS_CAPTURE_RECORD_HEADER_LENGTH + length;
+
+    // micros() wraps every 71.6 minutes; consecutive records are always a forward step
+    if (_haveTime)
+    {
+        _time += (uint32_t)(record->timestamp - _lastTimestamp);
+    }
+    _haveTime = true;
+    _lastTimestamp = record->timestamp;
+
+    return true;
+}
+
+/**
+ * @brief Get the unwrapped time of the record returned last
+ *
+ * @return uint64_t µs since the first record of the capture
+ */
+uint64_t iSYSCaptureReader::time() const
+{
+    return _time;
+}
+
+/**
+ * @brief Check whether the capture ended inside a record
+ *
+ * @return bool true once next() has dropped an incomplete last record
+ */
+bool iSYSCaptureReader::truncated() const
+{
+    return _truncated;
+}
+
+/**
+ * @brief Get the format version from the file header
+ *
+ * @return uint8_t ISYS_CAPTURE_VERSION for captures this reader understands
+ */
+uint8_t iSYSCaptureReader::version() const
+{
+    return _version;
+}
+
+/**
+ * @brief Internal function to read and check the file header
+ *
+ * @return bool true if the file starts with a supported capture header
+ */
+bool iSYSCaptureReader::readHeader()
+{
+    uint8_t header[ISYS_CAPTURE_FILE_HEADER_LENGTH];
+
+    _start = 0;
+    _length = 0;
+    _eof = false;
+    _truncated = false;
+    _haveTime = false;
+    _lastTimestamp = 0;
+    _time = 0;
+
+    if (fread(header, 1, sizeof(header), _file) != sizeof(header) || memcmp(header, "iSYSCAP", 7) != 0)
+    {
+        return false;
+    }
+
+    _version = header[7];
+    return _version == ISYS_CAPTURE_VERSION;
+}
@@ -0,0 +1,68 @@
+#ifndef ISYSCAPTUREREADER_H
+#define ISYSCAPTUREREADER_H
+
+#include "iSYSCapture.h"
+
+#include <stdio.h>
+
+/**
+ * @brief Streaming reader for binary captures written by iSYS4001::setCapture()
+ *
+ * Reads the capture in large blocks so files of any size can be replayed with
+ * constant memory. fill() performs the file I/O; next() only walks records that
+ * are already buffered, so callers can time their processing without the I/O.
+ * Timestamps are unwrapped into a 64-bit µs clock that starts at the first record.
+ *
+ * @note Host-side tool; not part of the Arduino library.
+ *
+ * @example
+ *   iSYSCaptureReader reader;
+ *   if (reader.open("radar.cap")) {
+ *       iSYSCaptureRecord_t record;
+ *       const uint8_t *data;
+ *       while (reader.fill()) {
+ *           while (reader.next(&record, &data)) {
+ *               handleFrame(&record, data);
+ *           }
+ *       }
+ *   }
+ */
+class iSYSCaptureReader
+{
+
+public:
+    iSYSCaptureReader();
+    ~iSYSCaptureReader();
+
+    bool open(const char *path);
+    void close();
+    bool rewind();
+
+    bool fill();
+    bool next(iSYSCaptureRecord_t *record, const uint8_t **data);
+
+    uint64_t time() const;
+    bool truncated() const;
+    uint8_t version() const;
+
+private:
+    FILE *_file;
+    uint8_t *_buffer;
+    size_t _start;  // first unread byte in _buffer
+    size_t _length; // bytes in _buffer
+    bool _eof;
+    bool _truncated;
+    uint8_t _version;
+
+    bool _haveTime;
+    uint32_t _lastTimestamp;
+    uint64_t _time; // unwrapped µs since the first record
+
+    bool readHeader();
+
+    // Non-copyable: owns the file and the buffer
+    iSYSCaptureReader(const iSYSCaptureReader &);
+    iSYSCaptureReader &operator=(const iSYSCaptureReader &);
+};
+
+#endif
@@ -0,0 +1,838 @@
+#include "iSYSSimulator.h"
+
+// Start delimiter of the 32-bit target list long frame; the driver accepts any value other than SD2
+#define ISYS_SIMULATOR_LONG_FRAME_SD (0xA2)
+
+// Parameter sub-ids of 0xD4/0xD5 (see the iSYS4001 setters and getters)
+#define ISYS_PARAM_RANGE_MIN (0x08)
+#define ISYS_PARAM_RANGE_MAX (0x09)
+#define ISYS_PARAM_SIGNAL_MIN (0x0A)
+#define ISYS_PARAM_SIGNAL_MAX (0x0B)
+#define ISYS_PARAM_VELOCITY_MIN (0x0C)
+#define ISYS_PARAM_VELOCITY_MAX (0x0D)
+#define ISYS_PARAM_DIRECTION (0x0E)
+#define ISYS_PARAM_FILTER_TYPE (0x15)
+#define ISYS_PARAM_SIGNAL_FILTER (0x16)
+
+// Sub-ids of 0xD2/0xD3
+#define ISYS_DEVICE_PARAM_ADDRESS (0x01)
+#define ISYS_DEVICE_PARAM_RANGE_BOUND (0x10)
+
+/**
+ * @brief Constructor for the simulator
+ *
+ * @param transport Transport the driver under test is connected to (PTY master, socket, ...)
+ * @param address Device address after a factory reset (default 0x80)
+ *
+ * @note The simulator starts with factory settings, acquisition running and a static
+ *       scenario of one target.
+ */
+iSYSSimulator::iSYSSimulator(iSYSTransport &transport, uint8_t address)
+    : _transport(&transport), _parser(_rxBuffer, sizeof(_rxBuffer))
+{
+    memset(&_faults, 0, sizeof(_faults));
+    memset(&_stats, 0, sizeof(_stats));
+    _baud = 0;
+    _random = 0x2545F491u;
+    _queueHead = 0;
+    _queueCount = 0;
+    _lineFree = _transport->micros();
+    _lastUpdate = _transport->micros();
+
+    factoryReset();
+    _settings.address = address;
+    _eeprom = _settings;
+
+    setScenario(ISYS_SCENARIO_STATIC, 1);
+}
+
+/***************************************************************
+ *  CONFIGURATION FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Select the target scenario
+ *
+ * @param scenario ISYS_SCENARIO_STATIC, ISYS_SCENARIO_MOVING or ISYS_SCENARIO_RANDOM
+ * @param nrOfTargets Number of simulated targets (0 to MAX_TARGETS); the upper bound for ISYS_SCENARIO_RANDOM
+ *
+ * @return iSYSResult_t ERR_OK, or ERR_PARAMETER_OUT_OF_RANGE if nrOfTargets exceeds MAX_TARGETS
+ *
+ * @note The output filters still apply, so a target list can hold fewer targets than configured.
+ */
+iSYSResult_t iSYSSimulator::setScenario(iSYSSimulatorScenario_t scenario, uint8_t nrOfTargets)
+{
+    if (nrOfTargets > MAX_TARGETS)
+    {
+        return ERR_PARAMETER_OUT_OF_RANGE;
+    }
+
+    _scenario = scenario;
+    _nrOfTargets = nrOfTargets;
+
+    for (uint8_t i = 0; i < MAX_TARGETS; i++)
+    {
+        placeTarget(i);
+    }
+    _lastUpdate = _transport->micros();
+
+    return ERR_OK;
+}
+
+/**
+ * @brief Set the fault injection parameters
+ *
+ * @param faults Latency, jitter and fault rates; all zero disables fault injection
+ */
+void iSYSSimulator::setFaults(const iSYSSimulatorFaults_t &faults)
+{
+    _faults = faults;
+}
+
+/**
+ * @brief Pace responses at the wire speed of a serial link
+ *
+ * @param baud Simulated baud rate (10 bits per byte), or 0 to write responses as fast as the transport accepts them
+ */
+void iSYSSimulator::setBaud(uint32_t baud)
+{
+    _baud = baud;
+}
+
+/**
+ * @brief Seed the generator used for the scenarios and fault injection
+ *
+ * @param seed Any value; the same seed reproduces the same sequence of targets and faults
+ */
+void iSYSSimulator::setSeed(uint32_t seed)
+{
+    _random = (seed != 0) ? seed : 0x2545F491u;
+    setScenario(_scenario, _nrOfTargets);
+}
+
+/**
+ * @brief Restore the factory parameter set of the sensor
+ *
+ * Same effect as the 0xDF factory settings command: address 0x80, 0-150 m range
+ * bound and the default output windows on all three outputs.
+ */
+void iSYSSimulator::factoryReset()
+{
+    memset(&_settings, 0, sizeof(_settings));
+    _settings.address = 0x80;
+    _settings.rangeBound = true;
+    _acquiring = true;
+
+    for (uint8_t output = 0; output < 3; output++)
+    {
+        uint16_t *parameters = _settings.parameters[output];
+        parameters[ISYS_PARAM_RANGE_MIN] = 0;       // 0.0 m
+        parameters[ISYS_PARAM_RANGE_MAX] = 1500;    // 150.0 m
+        parameters[ISYS_PARAM_SIGNAL_MIN] = 0;      // 0.0 dB
+        parameters[ISYS_PARAM_SIGNAL_MAX] = 1500;   // 150.0 dB
+        parameters[ISYS_PARAM_VELOCITY_MIN] = 0;    // 0.0 m/s
+        parameters[ISYS_PARAM_VELOCITY_MAX] = 694;  // 69.4 m/s (250 km/h)
+        parameters[ISYS_PARAM_DIRECTION] = ISYS_TARGET_DIRECTION_BOTH;
+        parameters[ISYS_PARAM_FILTER_TYPE] = ISYS_OUTPUT_FILTER_HIGHEST_SIGNAL;
+        parameters[ISYS_PARAM_SIGNAL_FILTER] = ISYS_OFF;
+    }
+}
+
+/**
+ * @brief Simulate switching the sensor off and on again
+ *
+ * Restores the settings last saved with a 0xDF EEPROM command, restarts acquisition
+ * and discards pending requests and responses. Unsaved parameter changes are lost,
+ * which is what a missing saveApplicationSettings() call does on the real sensor.
+ */
+void iSYSSimulator::powerCycle()
+{
+    _settings = _eeprom;
+    _acquiring = true;
+    _parser.reset();
+    _queueHead = 0;
+    _queueCount = 0;
+    _lineFree = _transport->micros();
+}
+
+/***************************************************************
+ *  RUNTIME FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Process received requests and write responses whose latency has expired
+ *
+ * Call continuously; never blocks. Every complete request in the receive buffer
+ * is answered (or dropped by fault injection) in one call.
+ */
+void iSYSSimulator::poll()
+{
+    for (;;)
+    {
+        if (_parser.frameReady())
+        {
+            handleRequest(_parser.frame(), _parser.frameLength());
+            _parser.releaseFrame();
+            continue;
+        }
+
+        int available = _transport->available();
+        if (available <= 0)
+        {
+            break;
+        }
+
+        uint16_t space;
+        uint8_t *target = _parser.writeBuffer(&space);
+        if (space == 0)
+        {
+            _parser.reset();
+            continue;
+        }
+        uint16_t chunk = ((uint16_t)available < space) ? (uint16_t)available : space;
+        _parser.commit((uint16_t)_transport->read(target, chunk));
+    }
+
+    sendDueResponses();
+}
+
+/**
+ * @brief Get the time until the next queued response (or the next chunk of it) is due
+ *
+ * @return int32_t µs until poll() has bytes to write (0 if overdue), or -1 if nothing is queued
+ *
+ * @note While a paced response is being written the next chunk is reported 1 ms ahead,
+ *       so callers sleeping on this value do not wake up for every byte.
+ *
+ * @example
+ *   int32_t wait = sensor.nextEventIn();
+ *   ::poll(&pfd, 1, (wait < 0) ? 100 : wait / 1000);
+ */
+int32_t iSYSSimulator::nextEventIn()
+{
+    if (_queueCount == 0)
+    {
+        return -1;
+    }
+
+    if (_queue[_queueHead].sent > 0)
+    {
+        return 1000;
+    }
+
+    int32_t remaining = (int32_t)(_queue[_queueHead].due - _transport->micros());
+    return (remaining > 0) ? remaining : 0;
+}
+
+/***************************************************************
+ *  STATUS FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Get the current device address
+ *
+ * @return uint8_t Address the simulator answers to (changed by 0xD3)
+ */
+uint8_t iSYSSimulator::getAddress()
+{
+    return _settings.address;
+}
+
+/**
+ * @brief Check whether acquisition is running
+ *
+ * @return bool true after start-up or 0xD1 start, false after 0xD1 stop
+ */
+bool iSYSSimulator::isAcquiring()
+{
+    return _acquiring;
+}
+
+/**
+ * @brief Get the simulator counters
+ *
+ * @return const iSYSSimulatorStats_t* Pointer to the live counters
+ */
+const iSYSSimulatorStats_t *iSYSSimulator::getStats()
+{
+    return &_stats;
+}
+
+/**
+ * @brief Reset all simulator counters to zero
+ */
+void iSYSSimulator::resetStats()
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+/***************************************************************
+ *  REQUEST HANDLING FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Internal function to answer one request frame
+ *
+ * @param frame Complete request frame from the parser
+ * @param length Frame length in bytes
+ */
+void iSYSSimulator::handleRequest(const uint8_t *frame, uint16_t length)
+{
+    // Requests are SD2 frames: 0x68 LE LE 0x68 DA SA FC data FCS 0x16
+    if (frame[0] != ISYS_FRAME_SD2 || length < 9)
+    {
+        _stats.ignored++;
+        return;
+    }
+
+    const uint8_t destAddress = frame[4];
+    const uint8_t functionCode = frame[6];
+    const uint8_t *data = &frame[7];
+    const uint16_t dataLength = length - 9;
+
+    uint8_t fcs = 0;
+    for (uint16_t i = 4; i < length - 2; i++)
+    {
+        fcs += frame[i];
+    }
+
+    // The broadcast address 0x00 is only answered for address queries
+    const bool broadcast = (destAddress == 0x00) && (functionCode == 0xD2);
+    if ((destAddress != _settings.address && !broadcast) || fcs != frame[length - 2])
+    {
+        _stats.ignored++;
+        return;
+    }
+
+    _stats.requests++;
+
+    switch (functionCode)
+    {
+    case 0xDA: // target list: output, format (0x10 = 16-bit, 0x20 = 32-bit)
+        if (dataLength == 2 && data[0] >= 1 && data[0] <= 3 && (data[1] == 0x10 || data[1] == 0x20))
+        {
+            handleTargetListRequest(data[0], data[1]);
+            return;
+        }
+        break;
+
+    case 0xD4: // get parameter: output, sub-id
+        if (dataLength == 2 && data[0] >= 1 && data[0] <= 3 && data[1] < ISYS_SIMULATOR_PARAMETERS)
+        {
+            queueValue(0xD4, _settings.parameters[data[0] - 1][data[1]]);
+            return;
+        }
+        break;
+
+    case 0xD5: // set parameter: output, sub-id, value (big endian)
+        if (dataLength == 4 && data[0] >= 1 && data[0] <= 3 && data[1] < ISYS_SIMULATOR_PARAMETERS)
+        {
+            _settings.parameters[data[0] - 1][data[1]] = (uint16_t)((data[2] << 8) | data[3]);
+            queueAck(_settings.address, 0xD5);
+            return;
+        }
+        break;
+
+    case 0xD1: // acquisition: 0x00, 0x00 = start / 0x01 = stop
+        if (dataLength == 2 && data[0] == 0x00 && data[1] <= 0x01)
+        {
+            _acquiring = (data[1] == 0x00);
+            queueAck(_settings.address, 0xD1);
+            return;
+        }
+        break;
+
+    case 0xD2: // get device parameter: 0x00, sub-id
+        if (dataLength == 2 && data[1] == ISYS_DEVICE_PARAM_ADDRESS)
+        {
+            queueValue(0xD2, _settings.address);
+            return;
+        }
+        if (dataLength == 2 && data[1] == ISYS_DEVICE_PARAM_RANGE_BOUND)
+        {
+            queueValue(0xD2, _settings.rangeBound ? ISYS_RANGE_0_TO_150 : ISYS_RANGE_0_TO_50);
+            return;
+        }
+        break;
+
+    case 0xD3: // set device parameter: 0x00, sub-id, value (big endian)
+        if (dataLength == 4 && data[1] == ISYS_DEVICE_PARAM_ADDRESS && data[3] != 0x00 && data[3] != ISYS_FRAME_MASTER_ADDRESS)
+        {
+            // The acknowledgement already comes from the new address
+            _settings.address = data[3];
+            queueAck(_settings.address, 0xD3);
+            return;
+        }
+        if (dataLength == 4 && data[1] == ISYS_DEVICE_PARAM_RANGE_BOUND && data[3] <= ISYS_RANGE_0_TO_150)
+        {
+            _settings.rangeBound = (data[3] == ISYS_RANGE_0_TO_150);
+            queueAck(_settings.address, 0xD3);
+            return;
+        }
+        break;
+
+    case 0xDF: // EEPROM: 1 = factory settings, 2 = save sensor, 3 = save application, 4 = save all
+        if (dataLength == 1 && data[0] >= 1 && data[0] <= 4)
+        {
+            if (data[0] == 1)
+            {
+                // The sensor keeps its address across a factory reset so the master can still reach it
+                const uint8_t address = _settings.address;
+                factoryReset();
+                _settings.address = address;
+            }
+            else
+            {
+                _eeprom = _settings;
+            }
+            queueAck(_settings.address, 0xDF);
+            return;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    // The sensor does not answer unknown commands; the master runs into its timeout
+    _stats.unsupported++;
+}
+
+/**
+ * @brief Internal function to answer a 0xDA target list request
+ *
+ * @param output Output number from the request (1 to 3)
+ * @param format 0x10 for the 16-bit SD2 frame, 0x20 for the 32-bit long frame
+ */
+void iSYSSimulator::handleTargetListRequest(uint8_t output, uint8_t format)
+{
+    iSYSSimulatorResponse_t *response = allocateResponse();
+    if (response == nullptr)
+    {
+        return;
+    }
+
+    updateTargets();
+
+    uint8_t nrOfTargets = 0;
+    bool clipping = chance(_faults.clipRate);
+    const uint8_t bytesPerTarget = (format == 0x20) ? ISYS_LONG_FRAME_BYTES_PER_TARGET : 7;
+    const uint16_t headerLength = (format == 0x20) ? ISYS_LONG_FRAME_HEADER_LENGTH : 9;
+    uint8_t *pData = &response->data[headerLength];
+
+    if (clipping)
+    {
+        _stats.clipped++;
+    }
+
+    uint8_t count = _nrOfTargets;
+    if (_scenario == ISYS_SCENARIO_RANDOM && count > 0)
+    {
+        count = (uint8_t)(nextRandom() % (count + 1u));
+    }
+
+    for (uint8_t i = 0; !clipping && _acquiring && i < count; i++)
+    {
+        const iSYSSimulatorTarget_t *target = &_targets[i];
+        if (!acceptsTarget(output, target))
+        {
+            continue;
+        }
+
+        if (format == 0x20)
+        {
+            const int16_t signal = (int16_t)lroundf(target->signal * 100.0f);
+            const int32_t velocity = (int32_t)lroundf(target->velocity * 1000.0f);
+            const int32_t range = (int32_t)lround((double)target->range * 1000000.0);
+            const int32_t angle = (int32_t)lroundf(target->angle * 100.0f);
+
+            *pData++ = (uint8_t)(signal >> 8);
+            *pData++ = (uint8_t)signal;
+            for (int8_t shift = 24; shift >= 0; shift -= 8)
+                *pData++ = (uint8_t)(velocity >> shift);
+            for (int8_t shift = 24; shift >= 0; shift -= 8)
+                *pData++ = (uint8_t)(range >> shift);
+            for (int8_t shift = 24; shift >= 0; shift -= 8)
+                *pData++ = (uint8_t)(angle >> shift);
+        }
+        else
+        {
+            const int16_t velocity = (int16_t)lroundf(target->velocity * 100.0f);
+            const int16_t range = (int16_t)lroundf(target->range * 100.0f);
+            const int16_t angle = (int16_t)lroundf(target->angle * 100.0f);
+
+            *pData++ = (uint8_t)lroundf(target->signal);
+            *pData++ = (uint8_t)(velocity >> 8);
+            *pData++ = (uint8_t)velocity;
+            *pData++ = (uint8_t)(range >> 8);
+            *pData++ = (uint8_t)range;
+            *pData++ = (uint8_t)(angle >> 8);
+            *pData++ = (uint8_t)angle;
+        }
+        nrOfTargets++;
+    }
+
+    uint8_t *frame = response->data;
+    if (format == 0x20)
+    {
+        // Long frame: SD DA SA FC output nrOfTargets data FCS 0x16, FCS summed from DA
+        frame[0] = ISYS_SIMULATOR_LONG_FRAME_SD;
+        frame[1] = ISYS_FRAME_MASTER_ADDRESS;
+        frame[2] = _settings.address;
+        frame[3] = ISYS_FRAME_FC_TARGET_LIST;
+        frame[4] = output;
+        frame[5] = clipping ? 0xFF : nrOfTargets;
+        response->length = headerLength + (uint16_t)nrOfTargets * bytesPerTarget;
+        finishFrame(response, 1);
+    }
+    else
+    {
+        // SD2 frame: 0x68 LE LE 0x68 DA SA FC output nrOfTargets data FCS 0x16
+        const uint8_t le = (uint8_t)(5 + nrOfTargets * bytesPerTarget);
+        frame[0] = ISYS_FRAME_SD2;
+        frame[1] = le;
+        frame[2] = le;
+        frame[3] = ISYS_FRAME_SD2;
+        frame[4] = ISYS_FRAME_MASTER_ADDRESS;
+        frame[5] = _settings.address;
+        frame[6] = ISYS_FRAME_FC_TARGET_LIST;
+        frame[7] = output;
+        frame[8] = clipping ? 0xFF : nrOfTargets;
+        response->length = headerLength + (uint16_t)nrOfTargets * bytesPerTarget;
+        finishFrame(response, 4);
+    }
+
+    _stats.targetListBytes += response->length;
+    queueResponse(response);
+}
+
+/**
+ * @brief Internal function to apply the output windows to a simulated target
+ *
+ * @param output Output number (1 to 3)
+ * @param target Simulated target
+ *
+ * @return bool true if the output reports the target
+ */
+bool iSYSSimulator::acceptsTarget(uint8_t output, const iSYSSimulatorTarget_t *target)
+{
+    const uint16_t *parameters = _settings.parameters[output - 1];
+    const float speed = fabsf(target->velocity);
+    const float rangeLimit = _settings.rangeBound ? 150.0f : 50.0f;
+    const uint16_t direction = parameters[ISYS_PARAM_DIRECTION];
+
+    if (target->range > rangeLimit)
+        return false;
+    if (target->range < parameters[ISYS_PARAM_RANGE_MIN] * 0.1f || target->range > parameters[ISYS_PARAM_RANGE_MAX] * 0.1f)
+        return false;
+    if (target->signal < parameters[ISYS_PARAM_SIGNAL_MIN] * 0.1f || target->signal > parameters[ISYS_PARAM_SIGNAL_MAX] * 0.1f)
+        return false;
+    if (speed < parameters[ISYS_PARAM_VELOCITY_MIN] * 0.1f || speed > parameters[ISYS_PARAM_VELOCITY_MAX] * 0.1f)
+        return false;
+    if (target->velocity < 0.0f && !(direction & ISYS_TARGET_DIRECTION_APPROACHING))
+        return false;
+    if (target->velocity > 0.0f && !(direction & ISYS_TARGET_DIRECTION_RECEDING))
+        return false;
+
+    return true;
+}
+
+/***************************************************************
+ *  SCENARIO FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Internal function to advance the simulated targets to the current time
+ */
+void iSYSSimulator::updateTargets()
+{
+    const uint32_t now = _transport->micros();
+    const float elapsed = (float)(uint32_t)(now - _lastUpdate) * 1E-6f;
+    _lastUpdate = now;
+
+    for (uint8_t i = 0; i < _nrOfTargets; i++)
+    {
+        iSYSSimulatorTarget_t *target = &_targets[i];
+
+        if (_scenario == ISYS_SCENARIO_RANDOM)
+        {
+            placeTarget(i);
+        }
+        else if (_scenario == ISYS_SCENARIO_MOVING)
+        {
+            // Radial velocity is positive when receding; wrap at the 150 m limit of the sensor
+            target->range += target->velocity * elapsed;
+            if (target->range > 150.0f)
+                target->range -= 149.0f;
+            else if (target->range < 1.0f)
+                target->range += 149.0f;
+        }
+    }
+}
+
+/**
+ * @brief Internal function to give a simulated target its initial position and motion
+ *
+ * @param index Target index (0 to MAX_TARGETS - 1)
+ */
+void iSYSSimulator::placeTarget(uint8_t index)
+{
+    iSYSSimulatorTarget_t *target = &_targets[index];
+
+    if (_scenario == ISYS_SCENARIO_STATIC)
+    {
+        // Evenly spaced along the 150 m window with alternating direction; a Doppler radar
+        // only reports targets with a radial velocity, so the positions are fixed but not the speed
+        target->range = 2.0f + 4.0f * index;
+        target->velocity = (index & 1) ? 1.5f : -1.5f;
+        target->signal = 60.0f - index;
+        target->angle = (float)((int8_t)(index % 9) - 4) * 5.0f;
+        return;
+    }
+
+    target->range = randomFloat(1.0f, 150.0f);
+    target->velocity = randomFloat(0.5f, 40.0f) * (chance(0.5f) ? 1.0f : -1.0f);
+    target->signal = randomFloat(10.0f, 100.0f);
+    target->angle = randomFloat(-40.0f, 40.0f);
+}
+
+/***************************************************************
+ *  RESPONSE FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Internal function to reserve the next free slot of the response queue
+ *
+ * @return iSYSSimulatorResponse_t* Free slot, or nullptr if the queue is full (the request is dropped)
+ *
+ * @note The slot only becomes part of the queue once it is passed to queueResponse().
+ */
+iSYSSimulator::iSYSSimulatorResponse_t *iSYSSimulator::allocateResponse()
+{
+    if (_queueCount >= ISYS_SIMULATOR_QUEUE_LENGTH)
+    {
+        _stats.silenced++;
+        return nullptr;
+    }
+
+    return &_queue[(_queueHead + _queueCount) % ISYS_SIMULATOR_QUEUE_LENGTH];
+}
+
+/**
+ * @brief Internal function to queue a 9 byte acknowledgement
+ *
+ * @param sourceAddress Address the acknowledgement is sent from
+ * @param functionCode Function code of the acknowledged request
+ */
+void iSYSSimulator::queueAck(uint8_t sourceAddress, uint8_t functionCode)
+{
+    iSYSSimulatorResponse_t *response = allocateResponse();
+    if (response == nullptr)
+    {
+        return;
+    }
+
+    uint8_t *frame = response->data;
+    frame[0] = ISYS_FRAME_SD2;
+    frame[1] = 0x03;
+    frame[2] = 0x03;
+    frame[3] = ISYS_FRAME_SD2;
+    frame[4] = ISYS_FRAME_MASTER_ADDRESS;
+    frame[5] = sourceAddress;
+    frame[6] = functionCode;
+    response->length = 7;
+    finishFrame(response, 4);
+    queueResponse(response);
+}
+
+/**
+ * @brief Internal function to queue an 11 byte get response
+ *
+ * @param functionCode Function code of the request (0xD2 or 0xD4)
+ * @param value Raw 16-bit value, sent big endian
+ */
+void iSYSSimulator::queueValue(uint8_t functionCode, uint16_t value)
+{
+    iSYSSimulatorResponse_t *response = allocateResponse();
+    if (response == nullptr)
+    {
+        return;
+    }
+
+    uint8_t *frame = response->data;
+    frame[0] = ISYS_FRAME_SD2;
+    frame[1] = 0x05;
+    frame[2] = 0x05;
+    frame[3] = ISYS_FRAME_SD2;
+    frame[4] = ISYS_FRAME_MASTER_ADDRESS;
+    frame[5] = _settings.address;
+    frame[6] = functionCode;
+    frame[7] = (uint8_t)(value >> 8);
+    frame[8] = (uint8_t)value;
+    response->length = 9;
+    finishFrame(response, 4);
+    queueResponse(response);
+}
+
+/**
+ * @brief Internal function to append FCS and end delimiter to a response
+ *
+ * @param response Response whose length covers everything up to the FCS
+ * @param fcsStart Index of the first byte included in the FCS (4 for SD2, 1 for the long frame)
+ */
+void iSYSSimulator::finishFrame(iSYSSimulatorResponse_t *response, uint8_t fcsStart)
+{
+    uint8_t fcs = 0;
+    for (uint16_t i = fcsStart; i < response->length; i++)
+    {
+        fcs += response->data[i];
+    }
+
+    response->data[response->length++] = fcs;
+    response->data[response->length++] = ISYS_FRAME_END;
+}
+
+/**
+ * @brief Internal function to schedule a finished response, applying latency and faults
+ *
+ * @param response Slot returned by allocateResponse()
+ */
+void iSYSSimulator::queueResponse(iSYSSimulatorResponse_t *response)
+{
+    if (chance(_faults.silenceRate))
+    {
+        _stats.silenced++;
+        return;
+    }
+
+    if (chance(_faults.corruptRate))
+    {
+        response->data[response->length - 2] ^= (uint8_t)(1u << (nextRandom() % 8));
+        _stats.corrupted++;
+    }
+
+    if (_faults.dropRate > 0.0f)
+    {
+        uint16_t kept = 0;
+        for (uint16_t i = 0; i < response->length; i++)
+        {
+            if (chance(_faults.dropRate))
+            {
+                _stats.droppedBytes++;
+                continue;
+            }
+            response->data[kept++] = response->data[i];
+        }
+        response->length = kept;
+    }
+
+    const uint32_t now = _transport->micros();
+    uint32_t due = now + _faults.latency;
+    if (_faults.jitter > 0)
+    {
+        due += nextRandom() % (_faults.jitter + 1u);
+    }
+
+    // Half duplex: a response cannot start before the previous one has left the wire
+    if ((int32_t)(_lineFree - due) > 0)
+    {
+        due = _lineFree;
+    }
+    response->due = due;
+    response->sent = 0;
+    _lineFree = due;
+    if (_baud > 0)
+    {
+        _lineFree += (uint32_t)(((uint64_t)response->length * 10u * 1000000u) / _baud);
+    }
+
+    _queueCount++;
+}
+
+/**
+ * @brief Internal function to write every queued response whose time has come
+ *
+ * With a baud rate set, a response is written in chunks as its bytes would
+ * leave a real UART, so the driver sees realistic first-byte and completion times.
+ */
+void iSYSSimulator::sendDueResponses()
+{
+    while (_queueCount > 0)
+    {
+        iSYSSimulatorResponse_t *response = &_queue[_queueHead];
+        const uint32_t elapsed = _transport->micros() - response->due;
+        if ((int32_t)elapsed < 0)
+        {
+            break;
+        }
+
+        uint16_t due = response->length;
+        if (_baud > 0)
+        {
+            // Bytes whose 10 bit times have started by now
+            const uint64_t started = ((uint64_t)elapsed * _baud) / 10000000u + 1u;
+            due = (started < response->length) ? (uint16_t)started : response->length;
+        }
+
+        if (due > response->sent)
+        {
+            _transport->write(response->data + response->sent, due - response->sent);
+            response->sent = due;
+        }
+
+        if (response->sent < response->length)
+        {
+            break;
+        }
+
+        _stats.responses++;
+        _queueHead = (_queueHead + 1) % ISYS_SIMULATOR_QUEUE_LENGTH;
+        _queueCount--;
+    }
+}
+
+/***************************************************************
+ *  RANDOM FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Internal function to draw the next value of the xorshift32 generator
+ *
+ * @return uint32_t Pseudo-random value
+ */
+uint32_t iSYSSimulator::nextRandom()
+{
+    _random ^= _random << 13;
+    _random ^= _random >> 17;
+    _random ^= _random << 5;
+    return _random;
+}
+
+/**
+ * @brief Internal function to draw a uniformly distributed float
+ *
+ * @param min Lower bound
+ * @param max Upper bound
+ *
+ * @return float Value in [min, max]
+ */
+float iSYSSimulator::randomFloat(float min, float max)
+{
+    return min + (max - min) * (float)(nextRandom() >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief Internal function to decide whether an event with the given probability happens
+ *
+ * @param rate Probability from 0.0 to 1.0
+ *
+ * @return bool true with probability rate; always false for rate <= 0
+ */
+bool iSYSSimulator::chance(float rate)
+{
+    if (rate <= 0.0f)
+    {
+        return false;
+    }
+    return randomFloat(0.0f, 1.0f) < rate;
+}
@@ -0,0 +1,180 @@
+#ifndef ISYSSIMULATOR_H
+#define ISYSSIMULATOR_H
+
+#include "iSYS4001.h"
+
+// Number of responses that may wait for their latency to expire at the same time
+#define ISYS_SIMULATOR_QUEUE_LENGTH (4)
+
+// Number of parameter sub-ids stored per output (0xD4/0xD5 sub-id 0x00..0x1F)
+#define ISYS_SIMULATOR_PARAMETERS (0x20)
+
+/**
+ * @brief Target scenarios the simulator can emit
+ */
+typedef enum iSYSSimulatorScenario
+{
+    ISYS_SCENARIO_STATIC = 0, // targets at fixed ranges spread over the 150 m window
+    ISYS_SCENARIO_MOVING = 1, // targets move at constant speed and wrap at the range limits
+    ISYS_SCENARIO_RANDOM = 2  // random count (0..nrOfTargets) and random values on every request
+} iSYSSimulatorScenario_t;
+
+/**
+ * @brief Fault injection settings
+ *
+ * Rates are probabilities from 0.0 to 1.0 applied per response (per byte for dropRate).
+ */
+typedef struct iSYSSimulatorFaults
+{
+    uint32_t latency;  // µs from the end of a request to the start of its response
+    uint32_t jitter;   // µs of uniformly distributed extra latency
+    float dropRate;    // probability that a response byte is lost
+    float corruptRate; // probability that a response carries a wrong FCS
+    float silenceRate; // probability that a request is not answered at all
+    float clipRate;    // probability that a target list reports clipping (0xFF)
+} iSYSSimulatorFaults_t;
+
+/**
+ * @brief Simulator counters; all start at zero and wrap on overflow
+ */
+typedef struct iSYSSimulatorStats
+{
+    uint32_t requests;        // requests addressed to the simulator with a valid FCS
+    uint32_t responses;       // responses written to the transport
+    uint32_t ignored;         // frames for another address or with an invalid FCS
+    uint32_t unsupported;     // frames with an unknown function code or parameter
+    uint32_t silenced;        // requests left unanswered by fault injection
+    uint32_t corrupted;       // responses sent with a wrong FCS
+    uint32_t droppedBytes;    // response bytes lost by fault injection
+    uint32_t clipped;         // target lists sent as clipping frames
+    uint32_t targetListBytes; // bytes of target list responses written
+} iSYSSimulatorStats_t;
+
+/**
+ * @brief Protocol-accurate iSYS-4001 device simulator for host-side testing
+ *
+ * Answers the command set implemented by iSYS4001: 0xDA target lists in 16-bit
+ * and 32-bit format, 0xD4/0xD5 parameter get/set, 0xD1 acquisition start/stop,
+ * 0xD2/0xD3 device address and range bound, and 0xDF EEPROM commands. Parameter
+ * state is kept per output and filters the generated targets the way the sensor
+ * does (range, velocity and signal windows, direction). Requests are parsed with
+ * iSYSFrameParser, so the simulator tolerates the same garbage and fragmentation
+ * as the driver.
+ *
+ * Responses are delayed by the configured latency and, when a baud rate is set,
+ * written byte-paced at wire speed after the previous response, so throughput and
+ * latency measured against the simulator are close to what a real 115200 Bd link allows. Faults (dropped bytes,
+ * corrupted checksums, unanswered requests, clipping) are injected from a seeded
+ * generator so a failing run can be repeated exactly.
+ *
+ * @note Host-side tool; not part of the Arduino library.
+ *
+ * @example
+ *   iSYSPosixTransport transport;
+ *   transport.attach(ptyMaster);
+ *   iSYSSimulator sensor(transport, 0x80);
+ *   sensor.setScenario(ISYS_SCENARIO_MOVING, 8);
+ *   for (;;) {
+ *       sensor.poll();
+ *   }
+ */
+class iSYSSimulator
+{
+
+public:
+    iSYSSimulator(iSYSTransport &transport, uint8_t address = 0x80);
+
+    /***************************************************************
+     *  CONFIGURATION FUNCTIONS
+     ***************************************************************/
+    iSYSResult_t setScenario(iSYSSimulatorScenario_t scenario, uint8_t nrOfTargets);
+    void setFaults(const iSYSSimulatorFaults_t &faults);
+    void setBaud(uint32_t baud);
+    void setSeed(uint32_t seed);
+    void factoryReset();
+    void powerCycle();
+
+    /***************************************************************
+     *  RUNTIME FUNCTIONS
+     ***************************************************************/
+    void poll();
+    int32_t nextEventIn();
+
+    /***************************************************************
+     *  STATUS FUNCTIONS
+     ***************************************************************/
+    uint8_t getAddress();
+    bool isAcquiring();
+    const iSYSSimulatorStats_t *getStats();
+    void resetStats();
+
+private:
+    typedef struct
+    {
+        float range;    // m
+        float velocity; // m/s, negative while approaching
+        float signal;   // dB
+        float angle;    // deg
+    } iSYSSimulatorTarget_t;
+
+    typedef struct
+    {
+        uint32_t due;   // micros() timestamp at which the first byte is written
+        uint16_t length;
+        uint16_t sent;  // bytes already written
+        uint8_t data[ISYS_MAX_FRAME_LENGTH];
+    } iSYSSimulatorResponse_t;
+
+    typedef struct
+    {
+        uint8_t address;
+        bool rangeBound; // true: 150 m range bound, false: 50 m
+        uint16_t parameters[3][ISYS_SIMULATOR_PARAMETERS];
+    } iSYSSimulatorSettings_t;
+
+    iSYSTransport *_transport;
+    uint8_t _rxBuffer[ISYS_MAX_FRAME_LENGTH];
+    iSYSFrameParser _parser;
+
+    iSYSSimulatorSettings_t _settings;
+    iSYSSimulatorSettings_t _eeprom; // settings restored at start-up, written by 0xDF
+    bool _acquiring;
+
+    iSYSSimulatorScenario_t _scenario;
+    uint8_t _nrOfTargets;
+    iSYSSimulatorTarget_t _targets[MAX_TARGETS];
+    uint32_t _lastUpdate;
+
+    iSYSSimulatorFaults_t _faults;
+    uint32_t _baud;
+    uint32_t _lineFree; // micros() timestamp at which the previous response has left the wire
+    uint32_t _random;
+
+    iSYSSimulatorResponse_t _queue[ISYS_SIMULATOR_QUEUE_LENGTH];
+    uint8_t _queueHead;
+    uint8_t _queueCount;
+
+    iSYSSimulatorStats_t _stats;
+
+    /***************************************************************
+     *  HELPER FUNCTIONS
+     ***************************************************************/
+    void handleRequest(const uint8_t *frame, uint16_t length);
+    void handleTargetListRequest(uint8_t output, uint8_t format);
+    bool acceptsTarget(uint8_t output, const iSYSSimulatorTarget_t *target);
+    void updateTargets();
+    void placeTarget(uint8_t index);
+
+    iSYSSimulatorResponse_t *allocateResponse();
+    void queueAck(uint8_t sourceAddress, uint8_t functionCode);
+    void queueValue(uint8_t functionCode, uint16_t value);
+    void finishFrame(iSYSSimulatorResponse_t *response, uint8_t fcsStart);
+    void queueResponse(iSYSSimulatorResponse_t *response);
+    void sendDueResponses();
+
+    uint32_t nextRandom();
+    float randomFloat(float min, float max);
+    bool chance(float rate);
+};
+
+#endif
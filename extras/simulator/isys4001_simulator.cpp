@@ -0,0 +1,301 @@
+/*
+ * iSYS-4001 device simulator
+ *
+ * Creates a pseudo terminal (or opens an existing serial device) and answers the
+ * driver's requests like an iSYS-4001 sensor. Point the driver at the printed
+ * device path:
+ *
+ *   $ ./isys4001_simulator --scenario moving --targets 16 --latency 2000 --drop 0.001
+ *   iSYS-4001 simulator at address 0x80 on /dev/pts/5
+ *
+ *   iSYSPosixTransport transport;
+ *   transport.open("/dev/pts/5", 115200);
+ *   iSYS4001 radar(transport);
+ *
+ * SIGUSR1 simulates a power cycle (unsaved settings are lost); SIGINT/SIGTERM
+ * print the counters and exit.
+ */
+
+#include "iSYSSimulator.h"
+#include "iSYSPosixTransport.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+static volatile sig_atomic_t g_stop = 0;
+static volatile sig_atomic_t g_powerCycle = 0;
+
+static void onSignal(int signal)
+{
+    if (signal == SIGUSR1)
+    {
+        g_powerCycle = 1;
+    }
+    else
+    {
+        g_stop = 1;
+    }
+}
+
+static void usage(const char *program)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --device PATH     use an existing serial device instead of creating a PTY\n"
+            "  --link PATH       create a symlink to the PTY slave (e.g. /tmp/ttyISYS)\n"
+            "  --address ADDR    device address (default 0x80)\n"
+            "  --scenario NAME   static | moving | random (default static)\n"
+            "  --targets N       simulated targets, 0 to %d (default 1)\n"
+            "  --baud BAUD       pace responses at this wire speed, 0 = unpaced (default 115200)\n"
+            "  --latency US      response latency in microseconds (default 0)\n"
+            "  --jitter US       additional random latency in microseconds (default 0)\n"
+            "  --drop P          probability that a response byte is lost\n"
+            "  --corrupt P       probability that a response has a wrong FCS\n"
+            "  --silence P       probability that a request is not answered\n"
+            "  --clip P          probability that a target list reports clipping\n"
+            "  --seed N          seed for scenarios and faults (default 1)\n"
+            "  --stats SECONDS   print the counters periodically (default 0 = on exit only)\n",
+            program, MAX_TARGETS);
+}
+
+static void printStats(iSYSSimulator &sensor)
+{
+    const iSYSSimulatorStats_t *stats = sensor.getStats();
+    fprintf(stderr,
+            "requests %u responses %u ignored %u unsupported %u silenced %u corrupted %u dropped bytes %u clipped %u target list bytes %u\n",
+            (unsigned)stats->requests, (unsigned)stats->responses, (unsigned)stats->ignored,
+            (unsigned)stats->unsupported, (unsigned)stats->silenced, (unsigned)stats->corrupted,
+            (unsigned)stats->droppedBytes, (unsigned)stats->clipped, (unsigned)stats->targetListBytes);
+}
+
+// Create a PTY pair; the slave is kept open in raw mode so the master never sees a hang-up
+static int openPty(int *slave, const char **slavePath)
+{
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+    {
+        return -1;
+    }
+
+    *slavePath = ptsname(master);
+    if (*slavePath == nullptr)
+    {
+        close(master);
+        return -1;
+    }
+
+    *slave = open(*slavePath, O_RDWR | O_NOCTTY);
+    if (*slave < 0)
+    {
+        close(master);
+        return -1;
+    }
+
+    struct termios tty;
+    if (tcgetattr(*slave, &tty) == 0)
+    {
+        cfmakeraw(&tty);
+        tcsetattr(*slave, TCSANOW, &tty);
+    }
+
+    return master;
+}
+
+int main(int argc, char **argv)
+{
+    const char *device = nullptr;
+    const char *link = nullptr;
+    uint8_t address = 0x80;
+    iSYSSimulatorScenario_t scenario = ISYS_SCENARIO_STATIC;
+    unsigned nrOfTargets = 1;
+    uint32_t baud = 115200;
+    uint32_t seed = 1;
+    unsigned statsInterval = 0;
+    iSYSSimulatorFaults_t faults = {0, 0, 0.0f, 0.0f, 0.0f, 0.0f};
+
+    static const struct option options[] = {
+        {"device", required_argument, nullptr, 'd'},
+        {"link", required_argument, nullptr, 'L'},
+        {"address", required_argument, nullptr, 'a'},
+        {"scenario", required_argument, nullptr, 's'},
+        {"targets", required_argument, nullptr, 'n'},
+        {"baud", required_argument, nullptr, 'b'},
+        {"latency", required_argument, nullptr, 'l'},
+        {"jitter", required_argument, nullptr, 'j'},
+        {"drop", required_argument, nullptr, 'D'},
+        {"corrupt", required_argument, nullptr, 'C'},
+        {"silence", required_argument, nullptr, 'S'},
+        {"clip", required_argument, nullptr, 'K'},
+        {"seed", required_argument, nullptr, 'r'},
+        {"stats", required_argument, nullptr, 'p'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0}};
+
+    int option;
+    while ((option = getopt_long(argc, argv, "h", options, nullptr)) != -1)
+    {
+        switch (option)
+        {
+        case 'd':
+            device = optarg;
+            break;
+        case 'L':
+            link = optarg;
+            break;
+        case 'a':
+            address = (uint8_t)strtoul(optarg, nullptr, 0);
+            break;
+        case 's':
+            if (strcmp(optarg, "static") == 0)
+                scenario = ISYS_SCENARIO_STATIC;
+            else if (strcmp(optarg, "moving") == 0)
+                scenario = ISYS_SCENARIO_MOVING;
+            else if (strcmp(optarg, "random") == 0)
+                scenario = ISYS_SCENARIO_RANDOM;
+            else
+            {
+                usage(argv[0]);
+                return 2;
+            }
+            break;
+        case 'n':
+            nrOfTargets = (unsigned)strtoul(optarg, nullptr, 0);
+            break;
+        case 'b':
+            baud = (uint32_t)strtoul(optarg, nullptr, 0);
+            break;
+        case 'l':
+            faults.latency = (uint32_t)strtoul(optarg, nullptr, 0);
+            break;
+        case 'j':
+            faults.jitter = (uint32_t)strtoul(optarg, nullptr, 0);
+            break;
+        case 'D':
+            faults.dropRate = strtof(optarg, nullptr);
+            break;
+        case 'C':
+            faults.corruptRate = strtof(optarg, nullptr);
+            break;
+        case 'S':
+            faults.silenceRate = strtof(optarg, nullptr);
+            break;
+        case 'K':
+            faults.clipRate = strtof(optarg, nullptr);
+            break;
+        case 'r':
+            seed = (uint32_t)strtoul(optarg, nullptr, 0);
+            break;
+        case 'p':
+            statsInterval = (unsigned)strtoul(optarg, nullptr, 0);
+            break;
+        default:
+            usage(argv[0]);
+            return (option == 'h') ? 0 : 2;
+        }
+    }
+
+    if (nrOfTargets > MAX_TARGETS)
+    {
+        fprintf(stderr, "--targets must be 0 to %d\n", MAX_TARGETS);
+        return 2;
+    }
+
+    iSYSPosixTransport transport;
+    int master = -1;
+    int slave = -1;
+    const char *path = device;
+
+    if (device != nullptr)
+    {
+        if (!transport.open(device, baud ? baud : 115200))
+        {
+            perror(device);
+            return 1;
+        }
+    }
+    else
+    {
+        master = openPty(&slave, &path);
+        if (master < 0 || !transport.attach(master))
+        {
+            perror("pty");
+            return 1;
+        }
+        if (link != nullptr)
+        {
+            unlink(link);
+            if (symlink(path, link) != 0)
+            {
+                perror(link);
+                return 1;
+            }
+            path = link;
+        }
+    }
+
+    iSYSSimulator sensor(transport, address);
+    sensor.setSeed(seed);
+    sensor.setScenario(scenario, (uint8_t)nrOfTargets);
+    sensor.setFaults(faults);
+    sensor.setBaud(baud);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = onSignal;
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+    sigaction(SIGUSR1, &action, nullptr);
+
+    printf("iSYS-4001 simulator at address 0x%02X on %s\n", address, path);
+    fflush(stdout);
+
+    uint32_t lastStats = transport.millis();
+
+    while (!g_stop)
+    {
+        if (g_powerCycle)
+        {
+            g_powerCycle = 0;
+            sensor.powerCycle();
+            fprintf(stderr, "power cycle\n");
+        }
+
+        // Sleep until a request arrives or the next delayed response is due; sub-millisecond
+        // waits spin so short latencies stay accurate
+        int32_t wait = sensor.nextEventIn();
+        struct pollfd pfd = {transport.fd(), POLLIN, 0};
+        if (poll(&pfd, 1, (wait < 0) ? 100 : (int)(wait / 1000)) < 0 && errno != EINTR)
+        {
+            perror("poll");
+            break;
+        }
+
+        sensor.poll();
+
+        if (statsInterval > 0 && (uint32_t)(transport.millis() - lastStats) >= statsInterval * 1000u)
+        {
+            lastStats = transport.millis();
+            printStats(sensor);
+        }
+    }
+
+    printStats(sensor);
+
+    if (link != nullptr && device == nullptr)
+    {
+        unlink(link);
+    }
+    transport.close();
+    if (slave >= 0)
+    {
+        close(slave);
+        close(master);
+    }
+    return 0;
+}
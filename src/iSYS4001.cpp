@@ -1,4 +1,6 @@
 #include "iSYS4001.h"
+#include "iSYSTargetDecoder.h"
+#include <stddef.h>
 
 /**
  * @brief Constructor for iSYS4001 radar sensor interface
@@ -18,9 +20,65 @@
  *   iSYS4001 radar(Serial2, 115200);
  *
  */
+#if defined(ARDUINO)
 iSYS4001::iSYS4001(HardwareSerial &serial, uint32_t baud)
-    : _serial(serial), _baud(baud), _debugEnabled(false), _debugStream(nullptr)
+    : _baud(baud), _serialTransport(&serial), _transport(&_serialTransport), _debugEnabled(false), _debugStream(nullptr), _captureEnabled(false), _captureStream(nullptr), _latencyStats(nullptr), _adaptiveTimeout(nullptr), _parameterCache(nullptr), _parser(_rxBuffer, ISYS_MAX_FRAME_LENGTH), _nonBlocking(false), _zeroFill(false)
 {
+    memset(&_stream, 0, sizeof(_stream));
+    memset(&_batch, 0, sizeof(_batch));
+    memset(&_transaction, 0, sizeof(_transaction));
+    memset(&_linkStats, 0, sizeof(_linkStats));
+    _resyncBaseline = 0;
+    _transaction.state = ISYS_TRANSACTION_IDLE;
+    _transaction.result = ERR_OK;
+    _transaction.cacheEntry = ISYS_PARAMETER_CACHE_NONE;
+}
+#endif
+
+/**
+ * @brief Constructor for iSYS4001 radar sensor interface on a custom transport
+ *
+ * Runs the protocol stack over any iSYSTransport implementation, e.g. the
+ * POSIX transport for a Linux serial port, a PTY or a socket. The baud rate is
+ * configured by the transport.
+ *
+ * @param transport Reference to the transport; must outlive the iSYS4001 instance
+ *
+ * @note The constructor does not establish communication with the radar device.
+ *
+ * @example
+ *   // Linux gateway
+ *   iSYSPosixTransport transport;
+ *   transport.open("/dev/ttyUSB0", 115200);
+ *   iSYS4001 radar(transport);
+ */
+iSYS4001::iSYS4001(iSYSTransport &transport)
+    : _baud(0),
+#if defined(ARDUINO)
+      _serialTransport(nullptr),
+#endif
+      _transport(&transport), _debugEnabled(false), _debugStream(nullptr), _captureEnabled(false), _captureStream(nullptr), _latencyStats(nullptr), _adaptiveTimeout(nullptr), _parameterCache(nullptr), _parser(_rxBuffer, ISYS_MAX_FRAME_LENGTH), _nonBlocking(false), _zeroFill(false)
+{
+    memset(&_stream, 0, sizeof(_stream));
+    memset(&_batch, 0, sizeof(_batch));
+    memset(&_transaction, 0, sizeof(_transaction));
+    memset(&_linkStats, 0, sizeof(_linkStats));
+    _resyncBaseline = 0;
+    _transaction.state = ISYS_TRANSACTION_IDLE;
+    _transaction.result = ERR_OK;
+    _transaction.cacheEntry = ISYS_PARAMETER_CACHE_NONE;
+}
+
+/**
+ * @brief Get the transport the driver communicates through
+ *
+ * @return iSYSTransport& Transport passed to the constructor (or the HardwareSerial adapter)
+ *
+ * @note Useful for its monotonic clock: getTransport().millis() works on every platform.
+ */
+iSYSTransport &iSYS4001::getTransport()
+{
+    return *_transport;
 }
 
 /***************************************************************
@@ -32,7 +90,8 @@ iSYS4001::iSYS4001(HardwareSerial &serial, uint32_t baud)
  * Sets the debug output stream and enables or disables debug messages for
  * command/response frames sent to and received from the iSYS-4001 radar device.
  *
- * @param stream Reference to a Stream object (e.g., Serial) to send debug messages
+ * @param stream Reference to a Stream object (e.g., Serial) to send debug messages;
+ *               on host builds a stdio stream (e.g., *stderr)
  * @param enabled Boolean flag to enable (true) or disable (false) debug output
  *
  * @return iSYSResult_t ERR_OK if the debug stream is successfully set, or
@@ -50,13 +109,69 @@ iSYS4001::iSYS4001(HardwareSerial &serial, uint32_t baud)
  *       Serial.println("Failed to enable debug output");
  *   }
  */
-iSYSResult_t iSYS4001::setDebug(Stream &stream, bool enabled)
+iSYSResult_t iSYS4001::setDebug(iSYSDebugStream_t &stream, bool enabled)
 {
     _debugStream = &stream;
     _debugEnabled = enabled;
     return (_debugStream != nullptr) ? ERR_OK : ERR_NULL_POINTER;
 }
 
+/**
+ * @brief Enable or disable binary capture of the raw radar traffic
+ *
+ * Writes every frame the driver sends and every frame it receives (including
+ * frames for other devices and partial data left at a timeout) to the stream in
+ * the compact binary format described in iSYSCapture.h: an 8 byte record header
+ * with monotonic timestamp, direction, device address and length, followed by
+ * the raw frame bytes. The capture is about a fifth of the size of the
+ * setDebug() hex dump and cheap enough to leave running at full frame rate.
+ *
+ * @param stream Destination stream, e.g. an SD card File or a fast USB serial port;
+ *               on host builds a stdio stream opened in binary mode
+ * @param enabled true to start capturing, false to stop
+ *
+ * @return iSYSResult_t ERR_OK on success, or ERR_NULL_POINTER if the stream is invalid
+ *
+ * @note The 8 byte file header is written whenever capture is enabled on a stream
+ *       different from the previous one, so pausing and resuming capture on the same
+ *       stream does not insert a second header.
+ * @note The stream's write speed adds directly to the request/response loop; a slow
+ *       sink (9600 Bd serial) changes the timing just like the hex dump does.
+ *
+ * @example
+ *   File capture = SD.open("radar.cap", FILE_WRITE);
+ *   radar.setCapture(capture, true);
+ *
+ *   // Host build
+ *   FILE *capture = fopen("radar.cap", "wb");
+ *   radar.setCapture(*capture, true);
+ */
+iSYSResult_t iSYS4001::setCapture(iSYSCaptureStream_t &stream, bool enabled)
+{
+    iSYSCaptureStream_t *previous = _captureStream;
+
+    _captureStream = &stream;
+    _captureEnabled = enabled;
+
+    if (_captureStream == nullptr)
+    {
+        _captureEnabled = false;
+        return ERR_NULL_POINTER;
+    }
+
+    if (enabled && _captureStream != previous)
+    {
+        static const uint8_t header[ISYS_CAPTURE_FILE_HEADER_LENGTH] = {'i', 'S', 'Y', 'S', 'C', 'A', 'P', ISYS_CAPTURE_VERSION};
+#if defined(ARDUINO)
+        _captureStream->write(header, sizeof(header));
+#else
+        fwrite(header, 1, sizeof(header), _captureStream);
+#endif
+    }
+
+    return ERR_OK;
+}
+
 /**
  * @brief Internal debug helper function for printing text messages
  *
@@ -80,10 +195,16 @@ void iSYS4001::debugPrint(const char *msg, bool newline)
 {
     if (_debugEnabled && _debugStream && msg)
     {
+#if defined(ARDUINO)
         if (newline)
             _debugStream->println(msg);
         else
             _debugStream->print(msg);
+#else
+        fputs(msg, _debugStream);
+        if (newline)
+            fputc('\n', _debugStream);
+#endif
     }
 }
 
@@ -115,8 +236,9 @@ void iSYS4001::debugPrintHexFrame(const char *prefix, const uint8_t *data, size_
         return;
 
     if (prefix && *prefix)
-        _debugStream->print(prefix);
+        debugPrint(prefix);
 
+#if defined(ARDUINO)
     for (size_t i = 0; i < length; i++)
     {
         _debugStream->print(data[i] < 0x10 ? "0x0" : "0x");
@@ -124,1912 +246,2577 @@ void iSYS4001::debugPrintHexFrame(const char *prefix, const uint8_t *data, size_
         _debugStream->print(" ");
     }
     _debugStream->println();
+#else
+    for (size_t i = 0; i < length; i++)
+    {
+        fprintf(_debugStream, "0x%02X ", data[i]);
+    }
+    fputc('\n', _debugStream);
+#endif
+}
+
+/**
+ * @brief Internal helper function for writing one capture record
+ *
+ * @param direction ISYS_CAPTURE_TX, ISYS_CAPTURE_RX or ISYS_CAPTURE_RX_PARTIAL
+ * @param data Raw frame bytes
+ * @param length Number of bytes
+ *
+ * @note No-op while capture is disabled. The device address is taken from the frame:
+ *       the destination of requests, the source of SD2 and long frame responses.
+ */
+void iSYS4001::captureFrame(iSYSCaptureDirection_t direction, const uint8_t *data, uint16_t length)
+{
+    if (!(_captureEnabled && _captureStream) || data == nullptr)
+        return;
+
+    uint8_t address = 0;
+    if (direction == ISYS_CAPTURE_TX)
+    {
+        address = (length > 4) ? data[4] : 0;
+    }
+    else if (length > 5 && data[0] == ISYS_FRAME_SD2)
+    {
+        address = data[5];
+    }
+    else if (length > 2 && data[0] != ISYS_FRAME_SD2)
+    {
+        address = data[2];
+    }
+
+    const uint32_t timestamp = _transport->micros();
+    const uint8_t header[ISYS_CAPTURE_RECORD_HEADER_LENGTH] = {
+        (uint8_t)timestamp, (uint8_t)(timestamp >> 8), (uint8_t)(timestamp >> 16), (uint8_t)(timestamp >> 24),
+        (uint8_t)direction, address, (uint8_t)length, (uint8_t)(length >> 8)};
+
+#if defined(ARDUINO)
+    _captureStream->write(header, sizeof(header));
+    _captureStream->write(data, length);
+#else
+    fwrite(header, 1, sizeof(header), _captureStream);
+    fwrite(data, 1, length, _captureStream);
+#endif
 }
 
 /***************************************************************
- *  GET TARGET LIST FUNCTIONS
+ *  LINK STATISTICS FUNCTIONS
  ***************************************************************/
 
 /**
- * @brief Retrieve 16-bit target list from radar device
- *
- * Requests and receives a list of detected targets from the iSYS-4001 radar
- * using the 16-bit data format. The function first sends a target list request
- * to the specified output channel, then waits for and parses the response into
- * the provided iSYSTargetList_t structure.
+ * @brief Get a snapshot of the link-health counters
  *
- * @param pTargetList Pointer to iSYSTargetList_t structure that will receive the target list data
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for target list response
- * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * The counters are always maintained and cost a few increments per frame. They
+ * keep the error codes that are otherwise only returned once. Checksum failures
+ * with few resync bytes point to a noisy line, while timeouts and unrelated frames
+ * point to an overloaded bus or address conflicts.
  *
- * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response received within timeout
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame shorter than expected
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ * @param stats Destination for the snapshot
  *
- * @note This function clears the target list structure before filling it.
- * @note Internally, this calls sendTargetListRequest() and receiveTargetListResponse().
+ * @return iSYSResult_t ERR_OK, or ERR_NULL_POINTER if stats is nullptr
  *
  * @example
- *   // Get 16-bit target list from output 1
- *   iSYSTargetList_t targetList;
- *   iSYSResult_t res = radar.getTargetList16(&targetList, 0x80, 300, ISYS_OUTPUT_1);
- *   if (res == ERR_OK) {
- *       Serial.print("Number of targets: ");
- *       Serial.println(targetList.count);
- *   } else {
- *       Serial.print("Failed to get target list, error: ");
- *       Serial.println(res);
- *   }
+ *   iSYSLinkStats_t link;
+ *   radar.getLinkStats(&link);
+ *   Serial.print("FCS errors: ");
+ *   Serial.println(link.checksumFailures);
  */
-iSYSResult_t iSYS4001::getTargetList16(iSYSTargetList_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
+iSYSResult_t iSYS4001::getLinkStats(iSYSLinkStats_t *stats)
 {
-    memset(pTargetList, 0, sizeof(iSYSTargetList_t));
-    iSYSResult_t res = sendTargetListRequest(outputnumber, destAddress, 16);
-    if (res != ERR_OK)
-        return res;
-    res = receiveTargetListResponse(pTargetList, timeout, 16);
-    if (res != ERR_OK)
-        return res;
+    if (stats == nullptr)
+    {
+        return ERR_NULL_POINTER;
+    }
+
+    *stats = _linkStats;
+    stats->resyncBytes = _parser.discardedBytes() - _resyncBaseline;
     return ERR_OK;
 }
 
 /**
- * @brief Retrieve 32-bit target list from radar device
+ * @brief Reset all link-health counters to zero
+ */
+void iSYS4001::resetLinkStats()
+{
+    memset(&_linkStats, 0, sizeof(_linkStats));
+    _resyncBaseline = _parser.discardedBytes();
+}
+
+/***************************************************************
+ *  LATENCY STATISTICS FUNCTIONS
+ ***************************************************************/
+
+// Upper bucket limits in µs; the last bucket collects everything slower
+static const uint32_t latencyBucketLimits[ISYS_LATENCY_BUCKETS] = {
+    500, 1000, 2000, 3000, 5000, 7500, 10000, 15000,
+    20000, 30000, 50000, 75000, 100000, 200000, 500000, 0xFFFFFFFFu};
+
+/**
+ * @brief Start or stop recording per-command latency histograms
  *
- * Requests and receives a list of detected targets from the iSYS-4001 radar
- * using the 32-bit data format. The function first sends a target list request
- * to the specified output channel, then waits for and parses the response into
- * the provided iSYSTargetList_t structure.
+ * For every transaction the driver records the time from the end of the request
+ * to the first received byte and to the complete response frame, separately for
+ * each command class (target list, get, set, acquisition, device, EEPROM).
+ * Transactions that time out are counted in the histogram's timeouts field
+ * instead of a bucket. Recording costs a few comparisons per transaction.
  *
- * @param pTargetList Pointer to iSYSTargetList_t structure that will receive the target list data
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for target list response
- * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param stats Application-owned storage, or nullptr to stop recording. It is not
+ *              cleared; call resetLatencyStats() to start from zero.
  *
- * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response received within timeout
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame shorter than expected
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ * @return iSYSResult_t ERR_OK
  *
- * @note This function clears the target list structure before filling it.
- * @note Internally, this calls sendTargetListRequest() and receiveTargetListResponse().
+ * @note The storage must stay valid while recording is enabled.
  *
  * @example
- *   // Get 32-bit target list from output 2
- *   iSYSTargetList_t targetList;
- *   iSYSResult_t res = radar.getTargetList32(&targetList, 0x80, 300, ISYS_OUTPUT_2);
- *   if (res == ERR_OK) {
- *       Serial.print("Number of targets: ");
- *       Serial.println(targetList.count);
- *   } else {
- *       Serial.print("Failed to get target list, error: ");
- *       Serial.println(res);
- *   }
+ *   static iSYSLatencyStats_t latency;
+ *   radar.setLatencyStats(&latency);
+ *   radar.resetLatencyStats();
+ *   // ... after a few thousand target lists:
+ *   uint32_t p99 = radar.getLatencyPercentile(ISYS_COMMAND_TARGET_LIST, ISYS_LATENCY_COMPLETE, 990);
  */
-iSYSResult_t iSYS4001::getTargetList32(iSYSTargetList_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
+iSYSResult_t iSYS4001::setLatencyStats(iSYSLatencyStats_t *stats)
 {
-    memset(pTargetList, 0, sizeof(iSYSTargetList_t));
-    iSYSResult_t res = sendTargetListRequest(outputnumber, destAddress, 32);
-    if (res != ERR_OK)
-        return res;
-    res = receiveTargetListResponse(pTargetList, timeout, 32);
-    if (res != ERR_OK)
-        return res;
+    _latencyStats = stats;
     return ERR_OK;
 }
 
 /**
- * @brief Internal function to send target list request command to radar device
+ * @brief Clear all latency histograms
  *
- * Constructs and transmits a command frame to request target list data from
- * the iSYS-4001 radar device. The command specifies the output channel and data
- * precision (16-bit or 32-bit). This is an internal helper function used by
- * getTargetList16() and getTargetList32().
+ * @note No-op while no storage is set.
+ */
+void iSYS4001::resetLatencyStats()
+{
+    if (_latencyStats != nullptr)
+    {
+        memset(_latencyStats, 0, sizeof(*_latencyStats));
+    }
+}
+
+/**
+ * @brief Get one latency histogram
  *
- * @param outputnumber Output channel to request data from (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param bitrate Data precision: 16 for 16-bit format, 32 for 32-bit format
+ * @param commandClass Command class, e.g. ISYS_COMMAND_TARGET_LIST
+ * @param point ISYS_LATENCY_FIRST_BYTE or ISYS_LATENCY_COMPLETE
  *
- * @return iSYSResult_t ERR_OK on success, or error code if command transmission fails
+ * @return const iSYSLatencyHistogram_t* Histogram, or nullptr if recording is off or the arguments are out of range
+ */
+const iSYSLatencyHistogram_t *iSYS4001::getLatencyHistogram(iSYSCommandClass_t commandClass, iSYSLatencyPoint_t point)
+{
+    if (_latencyStats == nullptr || commandClass >= ISYS_COMMAND_CLASS_COUNT || point >= ISYS_LATENCY_POINT_COUNT)
+    {
+        return nullptr;
+    }
+    return &_latencyStats->histograms[commandClass][point];
+}
+
+/**
+ * @brief Estimate a latency percentile from a histogram
  *
- * @note This function only sends the command - it does not wait for or process the response
- * @note Used internally by getTargetList16() and getTargetList32() functions
- * @note The command frame includes proper framing, address, and checksum validation
+ * @param commandClass Command class, e.g. ISYS_COMMAND_TARGET_LIST
+ * @param point ISYS_LATENCY_FIRST_BYTE or ISYS_LATENCY_COMPLETE
+ * @param permille Percentile in per mille: 500 = p50, 990 = p99, 999 = p99.9
  *
- * @example
- *   // Internal usage - called by getTargetList16()
- *   iSYSResult_t res = sendTargetListRequest(ISYS_OUTPUT_1, 0x80, 16);
- *   if (res != ERR_OK) {
- *       // Handle error
- *   }
+ * @return uint32_t Upper limit in µs of the bucket holding the percentile (the recorded
+ *         maximum for the open last bucket, and never more than the maximum), or 0 without samples
+ *
+ * @note The result is as coarse as the buckets; see getLatencyBucketLimit().
  */
-iSYSResult_t iSYS4001::sendTargetListRequest(iSYSOutputNumber_t outputnumber, uint8_t destAddress, uint8_t bitrate)
+uint32_t iSYS4001::getLatencyPercentile(iSYSCommandClass_t commandClass, iSYSLatencyPoint_t point, uint16_t permille)
 {
+    const iSYSLatencyHistogram_t *histogram = getLatencyHistogram(commandClass, point);
+    if (histogram == nullptr || histogram->count == 0)
+    {
+        return 0;
+    }
 
-    uint8_t command[11];
-    uint8_t index = 0;
-
-    command[index++] = 0x68;
-    command[index++] = 0x05;
-    command[index++] = 0x05;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xDA;
-    command[index++] = outputnumber;
-    command[index++] = (bitrate == 32) ? 0x20 : 0x10; // 0x20 for 32-bit, 0x10 for 16-bit
+    if (permille > 1000)
+    {
+        permille = 1000;
+    }
 
-    uint8_t fcs = calculateFCS(command, 4, index - 1);
-    command[index++] = fcs;
-    command[index++] = 0x16;
+    // Rank of the sample at the percentile, rounded up
+    const uint32_t rank = (uint32_t)(((uint64_t)histogram->count * permille + 999u) / 1000u);
+    uint32_t seen = 0;
 
-    debugPrintHexFrame("Sending command to radar: ", command, 11);
+    for (uint8_t i = 0; i < ISYS_LATENCY_BUCKETS; i++)
+    {
+        seen += histogram->buckets[i];
+        if (seen >= rank && seen > 0)
+        {
+            return (latencyBucketLimits[i] < histogram->max) ? latencyBucketLimits[i] : histogram->max;
+        }
+    }
 
-    _serial.write(command, 11);
-    _serial.flush();
-    return ERR_OK;
+    return histogram->max;
 }
 
 /**
- * @brief Internal function to receive and process target list response from radar device
- *
- * Waits for and receives the target list response frame from the iSYS-4001 radar device.
- * The function handles the variable-length response based on the number of detected targets
- * and the data precision (16-bit or 32-bit). It validates the frame structure and
- * passes the data to decodeTargetFrame() for processing.
+ * @brief Get the upper limit of a histogram bucket
  *
- * @param pTargetList Pointer to target list structure that will receive the decoded data
- * @param timeout Maximum time in milliseconds to wait for the complete response
- * @param bitrate Data precision: 16 for 16-bit format, 32 for 32-bit format
+ * @param bucket Bucket index (0 to ISYS_LATENCY_BUCKETS - 1)
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response received before timeout
- *         - ERR_FRAME_INCOMPLETE: Response frame was truncated
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Frame structure validation failed
- *         - ERR_COMMAND_MAX_DATA_OVERFLOW: Too many targets in response
+ * @return uint32_t Largest latency in µs counted in the bucket (0xFFFFFFFF for the last bucket and out-of-range indices)
+ */
+uint32_t iSYS4001::getLatencyBucketLimit(uint8_t bucket)
+{
+    return (bucket < ISYS_LATENCY_BUCKETS) ? latencyBucketLimits[bucket] : 0xFFFFFFFFu;
+}
+
+/**
+ * @brief Internal function to map a function code to its latency command class
  *
- * @note This function handles the variable-length nature of target list responses
- * @note Used internally by getTargetList16() and getTargetList32() functions
- * @note The function first reads the header to determine expected response length
+ * @param functionCode Function code of the request
  *
- * @example
- *   // Internal usage - called by getTargetList32()
- *   iSYSTargetList_t targets;
- *   iSYSResult_t res = receiveTargetListResponse(&targets, 300, 32);
- *   if (res != ERR_OK) {
- *       // Handle communication error
- *   }
+ * @return iSYSCommandClass_t Command class, or ISYS_COMMAND_CLASS_COUNT for unknown codes
  */
-iSYSResult_t iSYS4001::receiveTargetListResponse(iSYSTargetList_t *pTargetList, uint32_t timeout, uint8_t bitrate)
+static iSYSCommandClass_t commandClassOf(uint8_t functionCode)
 {
-    uint32_t startTime = millis();
-    std::vector<uint8_t> buffer;
+    switch (functionCode)
+    {
+    case 0xDA:
+        return ISYS_COMMAND_TARGET_LIST;
+    case 0xD4:
+        return ISYS_COMMAND_GET;
+    case 0xD5:
+        return ISYS_COMMAND_SET;
+    case 0xD1:
+        return ISYS_COMMAND_ACQUISITION;
+    case 0xD2:
+    case 0xD3:
+        return ISYS_COMMAND_DEVICE;
+    case 0xDF:
+        return ISYS_COMMAND_EEPROM;
+    default:
+        return ISYS_COMMAND_CLASS_COUNT;
+    }
+}
 
-    // Determine header length and index where number-of-targets lives
-    const uint8_t headerLen = (bitrate == 32) ? 6 : 9;  // 0-based: need 6 bytes to read index 5, 9 for index 8
-    const uint8_t countIndex = (bitrate == 32) ? 5 : 8; // 6th index for 32-bit, 9th index for 16-bit
-    const uint8_t bytesPerTgt = (bitrate == 32) ? 14 : 7;
+/**
+ * @brief Internal function to record the latency of the pending transaction
+ *
+ * @param point ISYS_LATENCY_FIRST_BYTE when the first byte arrived, ISYS_LATENCY_COMPLETE
+ *              when the matching response frame is complete
+ */
+void iSYS4001::recordLatency(iSYSLatencyPoint_t point)
+{
+    _transaction.firstByteSeen = true;
 
-    // Read header first
-    while ((millis() - startTime) < timeout && buffer.size() < headerLen)
+    const iSYSCommandClass_t commandClass = commandClassOf(_transaction.functionCode);
+    if (_latencyStats == nullptr || commandClass == ISYS_COMMAND_CLASS_COUNT)
     {
-        if (_serial.available())
-        {
-            buffer.push_back(_serial.read());
-        }
+        return;
     }
-    if (buffer.size() < headerLen)
+
+    const uint32_t latency = _transport->micros() - _transaction.requestMicros;
+    iSYSLatencyHistogram_t *histogram = &_latencyStats->histograms[commandClass][point];
+
+    uint8_t bucket = 0;
+    while (latency > latencyBucketLimits[bucket])
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        bucket++;
     }
+    histogram->buckets[bucket]++;
 
-    uint8_t nrOfTargets = buffer[countIndex];
-    if (nrOfTargets > MAX_TARGETS && nrOfTargets != 0xFF)
+    if (histogram->count == 0 || latency < histogram->min)
     {
-        return ERR_COMMAND_MAX_DATA_OVERFLOW;
+        histogram->min = latency;
     }
-
-    const uint16_t expectedLength = headerLen + (bytesPerTgt * nrOfTargets) + 2;
-    buffer.reserve(expectedLength);
-
-    while ((millis() - startTime) < timeout && buffer.size() < expectedLength)
+    if (latency > histogram->max)
     {
-        if (_serial.available())
-        {
-            buffer.push_back(_serial.read());
-        }
+        histogram->max = latency;
     }
+    histogram->count++;
+}
 
-    if (buffer.size() != expectedLength)
+/**
+ * @brief Internal function to count a timed out transaction in its histograms
+ */
+void iSYS4001::recordLatencyTimeout()
+{
+    const iSYSCommandClass_t commandClass = commandClassOf(_transaction.functionCode);
+    if (_latencyStats == nullptr || commandClass == ISYS_COMMAND_CLASS_COUNT)
     {
-        return ERR_FRAME_INCOMPLETE;
+        return;
     }
 
-    if (buffer.back() != 0x16)
+    _latencyStats->histograms[commandClass][ISYS_LATENCY_COMPLETE].timeouts++;
+    if (!_transaction.firstByteSeen)
     {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
+        _latencyStats->histograms[commandClass][ISYS_LATENCY_FIRST_BYTE].timeouts++;
     }
-
-    debugPrintHexFrame("Received response from radar: ", buffer.data(), buffer.size());
-
-    return decodeTargetFrame(buffer.data(), buffer.size(), bitrate, pTargetList);
 }
 
+/***************************************************************
+ *  ADAPTIVE TIMEOUT FUNCTIONS
+ ***************************************************************/
+
 /**
- * @brief Internal function to decode target list frame data into structured format
+ * @brief Start or stop deriving timeouts from the observed response times
  *
- * Parses the raw frame data received from the radar device and extracts
- * target information into the iSYSTargetList_t structure. Handles both 16-bit
- * and 32-bit data formats with appropriate scaling and conversion. Validates
- * frame structure and populates target data including signal strength, velocity,
- * range, and angle for each detected target.
+ * The driver keeps a smoothed response time and its variation for each command
+ * class (target list, get, set, acquisition, device, EEPROM), updated from every
+ * answered request like a TCP retransmission timer. Each call then waits
+ * srtt + max(1 ms, 4 * rttvar), but at least minTimeout and at most the timeout
+ * passed to the call. A sensor that is missing from a multi-drop bus is then
+ * detected after a few ms more than its usual response time, instead of after
+ * the fixed 300 ms.
  *
- * @param frame_array Pointer to the raw frame data received from the device
- * @param nrOfElements Total number of bytes in the frame array
- * @param bitrate Data precision: 16 for 16-bit format, 32 for 32-bit format
- * @param targetList Pointer to target list structure to populate with decoded data
+ * A command class without samples uses the caller's timeout, so the first requests
+ * learn the response time. Every consecutive timeout doubles the derived timeout
+ * until a response arrives again, so a sensor that became slower is still measured.
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_COMMAND_NO_VALID_FRAME_FOUND: Frame structure validation failed
- *         - ERR_COMMAND_FAILURE: Invalid number of targets in frame
+ * @param state Application-owned storage, or nullptr to use the caller's timeouts again.
+ *              Its estimates are kept, so values saved from an earlier run can be restored;
+ *              call resetAdaptiveTimeout() to start from zero.
+ * @param minTimeout Floor in ms of every derived timeout (default ISYS_ADAPTIVE_MIN_TIMEOUT)
  *
- * @note This function handles the complex frame parsing and data conversion
- * @note Used internally by receiveTargetListResponse() function
- * @note Supports both 16-bit (7 bytes per target) and 32-bit (14 bytes per target) formats
- * @note Automatically handles clipping flag (0xFF) when device data is saturated
+ * @return iSYSResult_t ERR_OK
+ *
+ * @note The storage must stay valid while adaptive timeouts are enabled.
+ * @note iSYS_setOutputConfig() and readConfiguration() keep the caller's timeout for the
+ *       whole burst and are not measured.
+ * @note Keep the caller's timeout as long as the slowest legitimate response, e.g. the
+ *       first target list after iSYS_startAcquisition().
  *
  * @example
- *   // Internal usage - called by receiveTargetListResponse()
- *   uint8_t frame[100];
- *   iSYSTargetList_t targets;
- *   iSYSResult_t res = decodeTargetFrame(frame, 50, 32, &targets);
- *   if (res == ERR_OK) {
- *       // targets structure now contains decoded target data
- *   }
+ *   static iSYSAdaptiveTimeout_t adaptive;
+ *   radar.setAdaptiveTimeout(&adaptive);
+ *   // 300 ms is now only the limit; after a few lists a missing sensor fails in tens of ms
+ *   radar.getTargetList32(&targetList, 0x81, 300);
  */
-iSYSResult_t iSYS4001::decodeTargetFrame(uint8_t *frame_array, uint16_t nrOfElements, uint8_t bitrate, iSYSTargetList_t *targetList)
+iSYSResult_t iSYS4001::setAdaptiveTimeout(iSYSAdaptiveTimeout_t *state, uint32_t minTimeout)
 {
-    uint16_t ui16_fc;
-    uint8_t output_number;
-    uint8_t nrOfTargets;
-    uint8_t *pData;
-    int16_t tmp;
-    uint8_t i;
-
-    if (frame_array[0] == 0x68)
+    _adaptiveTimeout = state;
+    if (_adaptiveTimeout != nullptr)
     {
-        ui16_fc = 6;
+        _adaptiveTimeout->minTimeout = minTimeout;
     }
-    else
+    return ERR_OK;
+}
+
+/**
+ * @brief Forget all learned response times
+ *
+ * @note No-op while adaptive timeouts are disabled.
+ */
+void iSYS4001::resetAdaptiveTimeout()
+{
+    if (_adaptiveTimeout != nullptr)
     {
-        ui16_fc = 3;
+        memset(_adaptiveTimeout->estimates, 0, sizeof(_adaptiveTimeout->estimates));
     }
+}
 
-    output_number = (uint16_t)(frame_array[ui16_fc + 1] & 0x00ff);
-    nrOfTargets = (uint16_t)(frame_array[ui16_fc + 2] & 0x00ff);
-    pData = &frame_array[ui16_fc + 3];
-
-    if (frame_array[nrOfElements - 1] != 0x16)
+/**
+ * @brief Get the timeout a request of a command class would use
+ *
+ * @param commandClass Command class, e.g. ISYS_COMMAND_TARGET_LIST
+ * @param timeout Timeout in ms passed to the call
+ *
+ * @return uint32_t Derived timeout in ms, or timeout itself while adaptive timeouts are
+ *         disabled or the class has no samples yet
+ */
+uint32_t iSYS4001::getAdaptiveTimeout(iSYSCommandClass_t commandClass, uint32_t timeout)
+{
+    if (_adaptiveTimeout == nullptr || commandClass >= ISYS_COMMAND_CLASS_COUNT)
     {
-        return ERR_COMMAND_NO_VALID_FRAME_FOUND;
+        return timeout;
     }
 
-    if ((nrOfTargets > MAX_TARGETS) && (nrOfTargets != 0xff))
+    const iSYSRttEstimate_t *estimate = &_adaptiveTimeout->estimates[commandClass];
+    if (estimate->samples == 0)
     {
-        return ERR_COMMAND_FAILURE;
+        return timeout;
     }
 
-    if (nrOfTargets != 0xff)
-    { // 0xff  clipping
-        for (i = 0; i < MAX_TARGETS; i++)
-        {
-            targetList->targets[i].angle = 0;
-            targetList->targets[i].range = 0;
-            targetList->targets[i].signal = 0;
-            targetList->targets[i].velocity = 0;
-        }
+    // RTO = SRTT + max(G, 4 * RTTVAR) with the 1 ms granularity of millis(), rounded up
+    const uint32_t variation = (estimate->rttvar < 250u) ? 1000u : 4u * estimate->rttvar;
+    uint32_t derived = (estimate->srtt + variation + 999u) / 1000u;
 
-        targetList->nrOfTargets = nrOfTargets;
-        targetList->clippingFlag = 0;
-        targetList->outputNumber = output_number;
+    for (uint8_t i = 0; i < estimate->backoff && derived < timeout; i++)
+    {
+        derived *= 2;
+    }
 
-        if (bitrate == 32)
-        {
-            int tmp32;
+    if (derived < _adaptiveTimeout->minTimeout)
+    {
+        derived = _adaptiveTimeout->minTimeout;
+    }
+    return (derived < timeout) ? derived : timeout;
+}
 
-            for (i = 0; i < nrOfTargets; i++)
-            {
-                tmp = (((*pData++) & 0x00ff) << 8);
-                tmp |= ((*pData++) & 0x00ff);
-                targetList->targets[i].signal = (float)(tmp * 0.01f);
-                tmp32 = (((*pData++) & 0x000000ff) << 24);
-                tmp32 |= (((*pData++) & 0x000000ff) << 16);
-                tmp32 |= (((*pData++) & 0x000000ff) << 8);
-                tmp32 |= ((*pData++) & 0x000000ff);
-                targetList->targets[i].velocity = (float)tmp32 * 0.001f;
-                tmp32 = (((*pData++) & 0x000000ff) << 24);
-                tmp32 |= (((*pData++) & 0x000000ff) << 16);
-                tmp32 |= (((*pData++) & 0x000000ff) << 8);
-                tmp32 |= ((*pData++) & 0x000000ff);
-                targetList->targets[i].range = (float)tmp32 * 1E-6f;
-                tmp32 = (((*pData++) & 0x000000ff) << 24);
-                tmp32 |= (((*pData++) & 0x000000ff) << 16);
-                tmp32 |= (((*pData++) & 0x000000ff) << 8);
-                tmp32 |= ((*pData++) & 0x000000ff);
-                targetList->targets[i].angle = (float)tmp32 * 0.01f;
-            }
-        }
+/**
+ * @brief Internal function to update the response time estimate of the pending transaction
+ *
+ * @param answered true when the matching response frame is complete, false on a timeout
+ */
+void iSYS4001::updateResponseTime(bool answered)
+{
+    const iSYSCommandClass_t commandClass = commandClassOf(_transaction.functionCode);
+    if (_adaptiveTimeout == nullptr || commandClass == ISYS_COMMAND_CLASS_COUNT)
+    {
+        return;
+    }
 
-        if (bitrate == 16)
+    iSYSRttEstimate_t *estimate = &_adaptiveTimeout->estimates[commandClass];
+    if (!answered)
+    {
+        if (estimate->backoff < 0xFF)
         {
-            for (i = 0; i < nrOfTargets; i++)
-            {
-                targetList->targets[i].signal = (float)((*pData++) & 0x00ff);
-                tmp = (((*pData++) & 0x00ff) << 8);
-                tmp |= ((*pData++) & 0x00ff);
-                targetList->targets[i].velocity = (float)tmp * 0.01f;
-                tmp = (((*pData++) & 0x00ff) << 8);
-                tmp |= ((*pData++) & 0x00ff);
-                targetList->targets[i].range = (float)tmp * 0.01f;
-                tmp = (((*pData++) & 0x00ff) << 8);
-                tmp |= ((*pData++) & 0x00ff);
-                targetList->targets[i].angle = (float)tmp * 0.01f;
-            }
+            estimate->backoff++;
         }
+        return;
     }
-    else
+
+    const uint32_t sample = _transport->micros() - _transaction.requestMicros;
+    if (estimate->samples == 0)
     {
-        targetList->clippingFlag = 1;
+        estimate->srtt = sample;
+        estimate->rttvar = sample / 2;
     }
-    if (nrOfTargets == MAX_TARGETS)
+    else
     {
-        targetList->error.iSYSTargetListError = TARGET_LIST_FULL;
+        // RTTVAR = 3/4 RTTVAR + 1/4 |SRTT - R|, SRTT = 7/8 SRTT + 1/8 R
+        const uint32_t deviation = (estimate->srtt > sample) ? estimate->srtt - sample : sample - estimate->srtt;
+        estimate->rttvar = estimate->rttvar - estimate->rttvar / 4 + deviation / 4;
+        estimate->srtt = estimate->srtt - estimate->srtt / 8 + sample / 8;
     }
-    else
+
+    if (estimate->samples < 0xFFFFFFFFu)
     {
-        targetList->error.iSYSTargetListError = TARGET_LIST_OK;
+        estimate->samples++;
     }
-    return ERR_OK;
+    estimate->backoff = 0;
 }
 
 /***************************************************************
- *  SET/GET RANGE MIN/MAX FUNCTIONS
+ *  PARAMETER CACHE FUNCTIONS
  ***************************************************************/
 
 /**
- * @brief Set the minimum detection range for a specified output channel
- *
- * Configures the minimum detection range threshold for the specified output channel
- * on the iSYS-4001 radar device. The range value is provided in meters and is
- * automatically converted to the device's internal 0.1m fixed-point format.
- *
- * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param range Minimum range in meters (0 to 149.9)
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
- *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_PARAMETER_OUT_OF_RANGE: Range value outside valid limits
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
- *
- * @note The function automatically converts meters to 0.1m fixed-point format (multiply by 10)
- * @note Integer inputs are recommended; floating-point values should be avoided to ensure consistent processing.
- * @note Changes take effect immediately but should be saved with saveApplicationSettings()
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @brief Start or stop caching the parameters of one device
+ *
+ * The cache remembers the last value the device confirmed for every per-output
+ * parameter (range, velocity and signal limits, direction, filter type, signal
+ * filter) and for the range bound and device address: values read by a getter and
+ * values acknowledged after a setter or iSYS_setOutputConfig(). A getter for a known
+ * value is then answered without a request, and a setter that would write the value
+ * the device already holds returns ERR_OK without sending it. Control loops that
+ * re-apply their thresholds periodically no longer take the bus away from target
+ * list polling.
+ *
+ * @param cache Application-owned storage, or nullptr to stop caching. It is cleared.
+ * @param destAddress Device whose parameters are cached; requests to other addresses
+ *        bypass the cache
+ *
+ * @return iSYSResult_t ERR_OK
+ *
+ * @note The storage must stay valid while caching is enabled.
+ * @note Answers from the cache return ERR_OK at once, also in non-blocking mode; no
+ *       transaction is started and poll() reports nothing for them.
+ * @note The driver cannot see changes it did not make: a power cycle before the values
+ *       were saved, another master on the bus or the sensor's own configuration tool.
+ *       Call invalidateParameterCache() after such events. setFactorySettings() and
+ *       failed or unanswered writes invalidate the affected entries automatically.
+ * @note Batch responses carry no parameter id. iSYS_setOutputConfig() and
+ *       readConfiguration() cache a value only once its response is tied to its request,
+ *       and invalidate the entries of requests still untied when the timeout expires.
  *
  * @example
- *   // Set minimum range to 5 meters for output 1
- *   iSYSResult_t res = radar.iSYS_setOutputRangeMin(ISYS_OUTPUT_1, 5, 0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.println("Minimum range set successfully");
- *   }
+ *   static iSYSParameterCache_t cache;
+ *   radar.setParameterCache(&cache, 0x80);
+ *   // Every few seconds; only changed thresholds go on the wire
+ *   radar.iSYS_setOutputRangeMin(ISYS_OUTPUT_1, rangeMin, 0x80, 300);
  */
-
-iSYSResult_t iSYS4001::iSYS_setOutputRangeMin(iSYSOutputNumber_t outputnumber, uint16_t range, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::setParameterCache(iSYSParameterCache_t *cache, uint8_t destAddress)
 {
+    _parameterCache = cache;
+    _transaction.cacheEntry = ISYS_PARAMETER_CACHE_NONE;
 
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
+    if (_parameterCache != nullptr)
     {
-        return ERR_OUTPUT_OUT_OF_RANGE;
+        memset(_parameterCache, 0, sizeof(*_parameterCache));
+        _parameterCache->address = destAddress;
     }
+    return ERR_OK;
+}
 
-    if (range < 0.0 || range >= 150)
+/**
+ * @brief Forget every cached parameter value
+ *
+ * The next getter and setter for each parameter goes to the device again.
+ *
+ * @note No-op while no cache is set.
+ */
+void iSYS4001::invalidateParameterCache()
+{
+    if (_parameterCache != nullptr)
     {
-        return ERR_PARAMETER_OUT_OF_RANGE;
+        _parameterCache->valid = 0;
     }
+}
 
-    if (timeout == 0)
+/**
+ * @brief Internal function to number the parameters of one device
+ *
+ * Per-output parameters come first in iSYSParameter_t and get three entries each
+ * (parameter * 3 + output - 1), followed by the range bound (27) and the device
+ * address (28). The parameter cache, the configuration snapshot's valid bits and
+ * the parameter batch share this numbering.
+ *
+ * @param parameter Parameter to number
+ * @param outputnumber Output channel for per-output parameters (already validated), ignored otherwise
+ *
+ * @return uint8_t Entry, below ISYS_PARAMETER_CACHE_ENTRIES
+ */
+uint8_t iSYS4001::parameterEntry(iSYSParameter_t parameter, uint8_t outputnumber)
+{
+    static_assert(ISYS_PARAMETER_RANGE_BOUND * 3 + (ISYS_PARAMETER_COUNT - ISYS_PARAMETER_RANGE_BOUND) == ISYS_PARAMETER_CACHE_ENTRIES,
+                  "ISYS_PARAMETER_CACHE_ENTRIES does not match iSYSParameter_t");
+
+    if (_parameters[parameter].flags & ISYS_PARAMETER_PER_OUTPUT)
     {
-        return ERR_TIMEOUT;
+        return (uint8_t)(parameter * 3 + (outputnumber - ISYS_OUTPUT_1));
     }
+    return (uint8_t)(ISYS_PARAMETER_RANGE_BOUND * 3 + (parameter - ISYS_PARAMETER_RANGE_BOUND));
+}
 
-    uint8_t command[13];
-    uint8_t index = 0;
-    uint16_t scaledRange = range * 10;
-    uint8_t minHighByte = (scaledRange >> 8) & 0xFF;
-    uint8_t minLowByte = scaledRange & 0xFF;
-
-    // Build command frame
-    command[index++] = 0x68;
-    command[index++] = 0x07;
-    command[index++] = 0x07;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD5;
-    command[index++] = outputnumber;
-    command[index++] = 0x08;
-    command[index++] = minHighByte;
-    command[index++] = minLowByte;
-
-    uint8_t fcs = calculateFCS(command, 4, 10);
-
-    command[11] = fcs;
-    command[12] = 0x16;
-
-    debugPrintHexFrame("Sending SET range min command to radar: ", command, 13);
-
-    size_t bytesWritten = _serial.write(command, 13);
-    _serial.flush();
-
-    if (bytesWritten != 13)
+/**
+ * @brief Internal function to split an entry of parameterEntry() into parameter and output
+ *
+ * @param entry Entry below ISYS_PARAMETER_CACHE_ENTRIES
+ * @param outputnumber Receives the output channel, 0 for device-level parameters
+ *
+ * @return iSYSParameter_t Parameter of the entry
+ */
+iSYS4001::iSYSParameter_t iSYS4001::entryParameter(uint8_t entry, uint8_t *outputnumber)
+{
+    if (entry < ISYS_PARAMETER_RANGE_BOUND * 3)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        *outputnumber = (uint8_t)(ISYS_OUTPUT_1 + entry % 3);
+        return (iSYSParameter_t)(entry / 3);
     }
 
-    // Response Buffer
-    uint8_t response[9];
-    size_t minIndex = 0;
-    uint32_t startTime = millis();
+    *outputnumber = 0;
+    return (iSYSParameter_t)(ISYS_PARAMETER_RANGE_BOUND + (entry - ISYS_PARAMETER_RANGE_BOUND * 3));
+}
 
-    while ((millis() - startTime) < timeout && minIndex < sizeof(response))
+/**
+ * @brief Internal function to find the cache entry of a parameter
+ *
+ * @param parameter Parameter to look up
+ * @param outputnumber Output channel for per-output parameters (already validated), ignored otherwise
+ * @param destAddress Device the request is for
+ *
+ * @return uint8_t Entry index, or ISYS_PARAMETER_CACHE_NONE if no cache is set or it
+ *         belongs to another device
+ */
+uint8_t iSYS4001::cacheEntry(iSYSParameter_t parameter, uint8_t outputnumber, uint8_t destAddress)
+{
+    if (_parameterCache == nullptr || destAddress != _parameterCache->address)
     {
-        if (_serial.available())
-        {
-            response[minIndex++] = _serial.read();
-
-            if (response[minIndex - 1] == 0x16)
-                break;
-        }
+        return ISYS_PARAMETER_CACHE_NONE;
     }
 
-    debugPrintHexFrame("Received SET range min acknowledgement: ", response, minIndex);
+    return parameterEntry(parameter, outputnumber);
+}
 
-    if (minIndex == 0)
+/**
+ * @brief Internal function to read a cache entry
+ *
+ * @param entry Entry from cacheEntry()
+ * @param rawValue Receives the cached value in the device's format
+ *
+ * @return bool true if the entry holds a confirmed value
+ */
+bool iSYS4001::cachedValue(uint8_t entry, uint16_t *rawValue)
+{
+    if (entry == ISYS_PARAMETER_CACHE_NONE || _parameterCache == nullptr || !(_parameterCache->valid & (1UL << entry)))
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        return false;
     }
 
-    if (minIndex < 9)
+    *rawValue = _parameterCache->values[entry];
+    return true;
+}
+
+/**
+ * @brief Internal function to record a value the device confirmed
+ *
+ * @param entry Entry from cacheEntry()
+ * @param rawValue Value in the device's format
+ *
+ * @note A confirmed device address also moves the cache to that address, since the
+ *       other entries still describe the same sensor.
+ * @note Callers pass only values tied to their own request; the batch paths call it
+ *       from recordBatchResult().
+ */
+void iSYS4001::storeCachedValue(uint8_t entry, uint16_t rawValue)
+{
+    if (entry == ISYS_PARAMETER_CACHE_NONE || _parameterCache == nullptr)
     {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
+        return;
     }
 
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD5 || response[8] != 0x16)
+    _parameterCache->values[entry] = rawValue;
+    _parameterCache->valid |= (1UL << entry);
+
+    if (entry == ISYS_PARAMETER_RANGE_BOUND * 3 + (ISYS_PARAMETER_DEVICE_ADDRESS - ISYS_PARAMETER_RANGE_BOUND))
     {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
+        _parameterCache->address = (uint8_t)rawValue;
     }
+}
 
-    if (minIndex == 9)
+/**
+ * @brief Internal function to forget one cache entry
+ *
+ * @param entry Entry from cacheEntry()
+ */
+void iSYS4001::invalidateCachedValue(uint8_t entry)
+{
+    if (entry != ISYS_PARAMETER_CACHE_NONE && _parameterCache != nullptr)
     {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
+        _parameterCache->valid &= ~(1UL << entry);
     }
-    return ERR_OK;
 }
 
+/***************************************************************
+ *  NON-BLOCKING TRANSACTION FUNCTIONS
+ ***************************************************************/
+
 /**
- * @brief Set the maximum detection range for a specified output channel
+ * @brief Enable or disable non-blocking (poll-driven) mode
  *
- * Configures the maximum detection range threshold for the specified output channel
- * on the iSYS-4001 radar device. The range value is provided in meters and is
- * automatically converted to the device's internal 0.1m fixed-point format.
+ * In blocking mode (the default) every public call sends its request and then
+ * waits inside the call until the response arrives or the timeout expires.
+ * In non-blocking mode the same calls send the request and return
+ * ERR_TRANSACTION_PENDING immediately. The response is then collected by
+ * calling poll() from the application loop, and the final result is read
+ * with getTransactionResult() once poll() reports ISYS_TRANSACTION_COMPLETE.
  *
- * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param range Maximum range in meters (0.1 to 150.0)
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ * @param enabled true to enable non-blocking mode, false to restore blocking mode
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_PARAMETER_OUT_OF_RANGE: Range value outside valid limits
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ * @return iSYSResult_t ERR_OK on success, or ERR_TRANSACTION_BUSY if a transaction
+ *         is still in progress (the mode cannot change mid-transaction)
  *
- * @note The function automatically converts meters to 0.1m fixed-point format (multiply by 10)
- * @note Integer inputs are recommended; floating-point values should be avoided to ensure consistent processing.
- * @note Changes take effect immediately but should be saved with saveApplicationSettings()
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @note Only one transaction can be in flight at a time. Starting another call while
+ *       one is pending returns ERR_TRANSACTION_BUSY without sending anything.
+ * @note Output pointers passed to getters and getTargetList16/32 are written when the
+ *       transaction completes, so they must stay valid until then.
  *
  * @example
- *   // Set maximum range to 100 meters for output 1
- *   iSYSResult_t res = radar.iSYS_setOutputRangeMax(ISYS_OUTPUT_1, 100, 0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.println("Maximum range set successfully");
+ *   radar.setNonBlocking(true);
+ *   radar.getTargetList32(&targetList, 0x80, 300, ISYS_OUTPUT_1); // returns ERR_TRANSACTION_PENDING
+ *   // ... later, in loop():
+ *   if (radar.poll() == ISYS_TRANSACTION_COMPLETE) {
+ *       iSYSResult_t res = radar.getTransactionResult();
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_setOutputRangeMax(iSYSOutputNumber_t outputnumber, uint16_t range, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::setNonBlocking(bool enabled)
 {
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
+    if (_transaction.state == ISYS_TRANSACTION_PENDING)
     {
-        return ERR_OUTPUT_OUT_OF_RANGE;
+        return ERR_TRANSACTION_BUSY;
     }
 
-    if (range < 0.1 || range > 150.0)
-    {
-        return ERR_PARAMETER_OUT_OF_RANGE;
-    }
+    _nonBlocking = enabled;
+    return ERR_OK;
+}
 
-    if (timeout == 0)
+/**
+ * @brief Advance the pending transaction
+ *
+ * Reads every byte currently available on the UART into the frame parser in bulk,
+ * skips complete frames that do not answer the pending request, completes the transaction as soon as the expected response frame is
+ * received, and fails it with the same error codes as the blocking API once
+ * the transaction timeout has expired. The function never waits for data.
+ *
+ * @return iSYSTransactionState_t State of the current transaction:
+ *         - ISYS_TRANSACTION_IDLE: No transaction has been started yet
+ *         - ISYS_TRANSACTION_PENDING: Still waiting for (more of) the response
+ *         - ISYS_TRANSACTION_COMPLETE: Finished; result available from getTransactionResult()
+ *
+ * @note Call this frequently from loop() while a non-blocking transaction is pending.
+ * @note While a target list stream is running (see startTargetListStream16/32()) poll()
+ *       returns ISYS_TRANSACTION_COMPLETE once per received list, even though the next
+ *       request is already pending.
+ * @note In blocking mode the public API calls poll() internally until completion.
+ *
+ * @example
+ *   void loop() {
+ *       if (radar.poll() == ISYS_TRANSACTION_COMPLETE) {
+ *           handleResult(radar.getTransactionResult());
+ *       }
+ *       doOtherWork();
+ *   }
+ */
+iSYSTransactionState_t iSYS4001::poll()
+{
+    if (_transaction.state != ISYS_TRANSACTION_PENDING)
     {
-        return ERR_TIMEOUT;
+        return _transaction.state;
     }
 
-    uint8_t command[13];
-    uint8_t index = 0;
-    uint16_t scaledRange = range * 10;
-    uint8_t maxHighByte = (scaledRange >> 8) & 0xFF;
-    uint8_t maxLowByte = scaledRange & 0xFF;
+    while (true)
+    {
+        if (_parser.frameReady())
+        {
+            captureFrame(ISYS_CAPTURE_RX, _parser.frame(), _parser.frameLength());
+            _linkStats.framesReceived++;
 
-    command[index++] = 0x68;
-    command[index++] = 0x07;
-    command[index++] = 0x07;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD5;
-    command[index++] = outputnumber;
-    command[index++] = 0x09;
-    command[index++] = maxHighByte;
-    command[index++] = maxLowByte;
+            if (matchesResponse(_parser.frame(), _parser.frameLength()))
+            {
+                recordLatency(ISYS_LATENCY_COMPLETE);
+                if (!_batch.active)
+                {
+                    updateResponseTime(true);
+                }
+
+                // Output configuration: one acknowledgement per pipelined request
+                if (_batch.active)
+                {
+                    iSYSResult_t result = evaluateResponse(_parser.frame(), _parser.frameLength());
+                    _parser.releaseFrame();
+                    if (advanceBatch(result))
+                    {
+                        continue;
+                    }
+                    return finishBatch(ERR_OK);
+                }
+
+                // Streaming: put the next request on the wire before decoding this frame
+                resetStreamTargetList();
+                bool rearmed = _stream.active && requestNextStreamFrame();
+
+                iSYSResult_t result = evaluateResponse(_parser.frame(), _parser.frameLength());
+                _parser.releaseFrame();
+                return completeTransaction(result, rearmed);
+            }
 
-    uint8_t fcs = calculateFCS(command, 4, 10);
+            // A late reply to an earlier request or traffic for another device
+            debugPrintHexFrame("Skipped unrelated frame: ", _parser.frame(), _parser.frameLength());
+            _transaction.unrelatedFrame = true;
+            _linkStats.unrelatedFrames++;
+            _parser.releaseFrame();
+            continue;
+        }
 
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Sending SET range max command to radar: ", command, 13);
-
-    size_t bytesWritten = _serial.write(command, 13);
-    _serial.flush();
-
-    if (bytesWritten != 13)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    uint8_t response[9];
-    uint32_t startTime = millis();
-    size_t maxIndex = 0;
-
-    while ((millis() - startTime) < timeout && maxIndex < 9)
-    {
-        if (_serial.available())
+        int available = _transport->available();
+        if (available <= 0)
         {
-            response[maxIndex++] = _serial.read();
-            if (response[maxIndex - 1] == 0x16)
-                break;
+            break;
         }
-    }
 
-    debugPrintHexFrame("Received SET range max acknowledgement: ", response, maxIndex);
+        // Drain everything the transport holds in one call instead of one read() per byte
+        uint16_t space;
+        uint8_t *dest = _parser.writeBuffer(&space);
+        uint16_t count = ((uint16_t)available < space) ? (uint16_t)available : space;
+        uint16_t received = (uint16_t)_transport->read(dest, count);
+        _parser.commit(received);
+        _linkStats.bytesIn += received;
 
-    if (maxIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        if (received > 0 && !_transaction.firstByteSeen)
+        {
+            recordLatency(ISYS_LATENCY_FIRST_BYTE);
+        }
     }
 
-    if (maxIndex < 9)
+    if ((_transport->millis() - _transaction.startTime) >= _transaction.timeout)
     {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
+        _linkStats.timeouts++;
+        recordLatencyTimeout();
+        if (!_batch.active)
+        {
+            updateResponseTime(false);
+        }
+        iSYSResult_t result = timeoutResult();
 
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD5 || response[8] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
+        // A partial or stale frame cannot belong to the next response
+        _parser.reset();
 
-    if (maxIndex >= 9)
-    {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
+        if (_batch.active)
         {
-            return ERR_INVALID_CHECKSUM;
+            return finishBatch(result);
         }
+
+        resetStreamTargetList();
+        bool rearmed = _stream.active && requestNextStreamFrame();
+        return completeTransaction(result, rearmed);
     }
 
-    return ERR_OK;
+    return _transaction.state;
 }
 
 /**
- * @brief Get the current minimum detection range for a specified output channel
+ * @brief Get the state of the current transaction without advancing it
  *
- * Retrieves the current minimum detection range threshold for the specified output channel
- * from the iSYS-4001 radar device. The range value is returned in meters after automatic
- * conversion from the device's internal 0.1m fixed-point format.
+ * @return iSYSTransactionState_t ISYS_TRANSACTION_IDLE, ISYS_TRANSACTION_PENDING or
+ *         ISYS_TRANSACTION_COMPLETE
  *
- * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param range Pointer to float variable that will receive the minimum range in meters
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for response
+ * @example
+ *   if (radar.getTransactionState() != ISYS_TRANSACTION_PENDING) {
+ *       radar.getTargetList16(&targetList, 0x80, 300);
+ *   }
+ */
+iSYSTransactionState_t iSYS4001::getTransactionState()
+{
+    return _transaction.state;
+}
+
+/**
+ * @brief Get the result of the most recent transaction
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_NULL_POINTER: range pointer is null
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ * Returns the error code the blocking API would have returned for the last
+ * request. While the transaction is still running this is ERR_TRANSACTION_PENDING.
  *
- * @note The function automatically converts from 0.1m fixed-point format to meters (divide by 10)
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @return iSYSResult_t Result of the last completed transaction, or ERR_TRANSACTION_PENDING
  *
  * @example
- *   // Get current minimum range for output 1
- *   float minRange = 0;
- *   iSYSResult_t res = radar.iSYS_getOutputRangeMin(ISYS_OUTPUT_1, &minRange, 0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.print("Current minimum range: ");
- *       Serial.print(minRange);
- *       Serial.println(" meters");
+ *   if (radar.poll() == ISYS_TRANSACTION_COMPLETE && radar.getTransactionResult() == ERR_OK) {
+ *       Serial.println(targetList.nrOfTargets);
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_getOutputRangeMin(iSYSOutputNumber_t outputnumber, float *range, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::getTransactionResult()
 {
-    if (range == NULL)
-    {
-        return ERR_NULL_POINTER;
-    }
-
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
-    {
-        return ERR_OUTPUT_OUT_OF_RANGE;
-    }
+    return _transaction.result;
+}
 
-    if (timeout == 0)
+/**
+ * @brief Internal function to transmit a complete command frame
+ *
+ * Writes the frame to the UART and waits until it has been shifted out. Refuses
+ * to send while another transaction is still waiting for its response, so a
+ * reply can never be attributed to the wrong request.
+ *
+ * @param frame Pointer to the fully built command frame (including FCS and end delimiter)
+ * @param length Number of bytes in the frame
+ *
+ * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
+ *         - ERR_TRANSACTION_BUSY: A non-blocking transaction is still pending
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: The UART did not accept the whole frame
+ *
+ * @note Used internally by every command/request helper
+ */
+iSYSResult_t iSYS4001::sendFrame(const uint8_t *frame, uint8_t length)
+{
+    if (_transaction.state == ISYS_TRANSACTION_PENDING)
     {
-        return ERR_TIMEOUT;
+        return ERR_TRANSACTION_BUSY;
     }
 
-    uint8_t command[11];
-    uint8_t index = 0;
-
-    command[index++] = 0x68;
-    command[index++] = 0x05;
-    command[index++] = 0x05;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD4;
-    command[index++] = outputnumber;
-    command[index++] = 0x08;
-
-    uint8_t fcs = calculateFCS(command, 4, 8);
-    command[index++] = fcs;
-    command[index++] = 0x16;
+    captureFrame(ISYS_CAPTURE_TX, frame, length);
 
-    debugPrintHexFrame("Sending GET Range Min command: ", command, sizeof(command));
+    size_t bytesWritten = _transport->write(frame, length);
+    _transport->flush();
 
-    size_t bytesWritten = _serial.write(command, 11);
-    _serial.flush();
+    _linkStats.framesSent++;
+    _linkStats.bytesOut += (uint32_t)bytesWritten;
 
-    if (bytesWritten != sizeof(command))
+    if (bytesWritten != length)
     {
         return ERR_COMMAND_NO_DATA_RECEIVED;
     }
 
-    uint8_t response[11];
-    uint32_t startTime = millis();
-    uint8_t rIdx = 0;
-    while ((millis() - startTime) < timeout && rIdx < 11)
-    {
-        if (_serial.available())
-        {
-            response[rIdx++] = _serial.read();
-            if (response[rIdx - 1] == 0x16)
-                break;
-        }
-    }
+    return ERR_OK;
+}
+
+/**
+ * @brief Internal function to start waiting for the response to a request just sent
+ *
+ * Arms the transaction state machine with the expected response layout. In
+ * blocking mode it then runs poll() until the transaction completes and returns
+ * its result; in non-blocking mode it returns ERR_TRANSACTION_PENDING at once.
+ *
+ * @param type Expected response layout (acknowledgement, parameter value, target list, ...)
+ * @param functionCode Function code the response must carry (0xD1, 0xD4, 0xDA, ...)
+ * @param sourceAddress Address the response must come from
+ * @param output Caller-owned destination for decoded data (nullptr for acknowledgements)
+ * @param timeout Maximum time in milliseconds to wait for the response
+ * @param debugLabel Prefix used when printing the received frame in debug mode
+ *
+ * @return iSYSResult_t Result of the transaction (blocking mode) or ERR_TRANSACTION_PENDING
+ *
+ * @note Used internally by every getter, setter and target list request
+ */
+iSYSResult_t iSYS4001::awaitResponse(iSYSResponseType_t type, uint8_t functionCode, uint8_t sourceAddress, void *output, uint32_t timeout, const char *debugLabel)
+{
+    armTransaction(type, functionCode, sourceAddress, output, timeout, debugLabel);
 
-    debugPrintHexFrame("Received Range Min response: ", response, rIdx);
+    // Bytes buffered before the request went out cannot belong to its response
+    _parser.reset();
 
-    if (rIdx == 0)
+    if (_nonBlocking)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        return ERR_TRANSACTION_PENDING;
     }
 
-    if (rIdx < 11)
+    while (poll() == ISYS_TRANSACTION_PENDING)
     {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
     }
 
-    if (response[0] != 0x68 || response[1] != 0x05 || response[2] != 0x05 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD4 || response[10] != 0x16)
+    return _transaction.result;
+}
+
+/**
+ * @brief Internal function to set up the transaction state for a request just sent
+ *
+ * @param type Expected response layout (acknowledgement, parameter value, target list, ...)
+ * @param functionCode Function code the response must carry
+ * @param sourceAddress Address the response must come from
+ * @param output Caller-owned destination for decoded data (nullptr for acknowledgements)
+ * @param timeout Maximum time in milliseconds to wait for the response
+ * @param debugLabel Prefix used when printing the received frame in debug mode
+ *
+ * @note Leaves the frame parser untouched, so a frame that is still being decoded
+ *       (streaming mode) stays valid.
+ * @note With adaptive timeouts enabled, timeout is the upper limit of the derived
+ *       timeout (see getAdaptiveTimeout()).
+ */
+void iSYS4001::armTransaction(iSYSResponseType_t type, uint8_t functionCode, uint8_t sourceAddress, void *output, uint32_t timeout, const char *debugLabel)
+{
+    _transaction.type = type;
+    _transaction.functionCode = functionCode;
+    _transaction.sourceAddress = sourceAddress;
+    _transaction.output = output;
+    _transaction.debugLabel = debugLabel;
+    _transaction.unrelatedFrame = false;
+    _transaction.startTime = _transport->millis();
+    _transaction.timeoutLimit = timeout;
+    // A pipelined batch shares one timeout across all of its responses
+    _transaction.timeout = _batch.active ? timeout : getAdaptiveTimeout(commandClassOf(functionCode), timeout);
+    _transaction.requestMicros = _transport->micros();
+    _transaction.firstByteSeen = false;
+    _transaction.streamCycle = false;
+    _transaction.result = ERR_TRANSACTION_PENDING;
+    _transaction.state = ISYS_TRANSACTION_PENDING;
+}
+
+/**
+ * @brief Internal function to finish the current transaction
+ *
+ * @param result Result of the transaction that just ended
+ * @param rearmed true if a streaming request was already sent for the next cycle
+ *
+ * @return iSYSTransactionState_t Always ISYS_TRANSACTION_COMPLETE, so poll() reports the
+ *         finished cycle even when the transaction state has moved on to the next request
+ */
+iSYSTransactionState_t iSYS4001::completeTransaction(iSYSResult_t result, bool rearmed)
+{
+    countResult(result);
+
+    if (_transaction.cacheEntry != ISYS_PARAMETER_CACHE_NONE)
     {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
+        if (result == ERR_OK)
+        {
+            storeCachedValue(_transaction.cacheEntry, _transaction.cacheValue);
+        }
+        _transaction.cacheEntry = ISYS_PARAMETER_CACHE_NONE;
     }
 
-    uint8_t expectedFCS = calculateFCS(response, 4, 8);
-    if (response[9] != expectedFCS)
+    _transaction.result = result;
+    if (!rearmed)
     {
-        return ERR_INVALID_CHECKSUM;
+        _transaction.state = ISYS_TRANSACTION_COMPLETE;
     }
-
-    uint16_t rawRange = (response[7] << 8) | response[8];
-    *range = (float)rawRange / 10.0f; // return in m(meters)
-
-    return ERR_OK;
+    return ISYS_TRANSACTION_COMPLETE;
 }
 
 /**
- * @brief Get the current maximum detection range for a specified output channel
- *
- * Retrieves the current maximum detection range threshold for the specified output channel
- * from the iSYS-4001 radar device. The range value is returned in meters after automatic
- * conversion from the device's internal 0.1m fixed-point format.
+ * @brief Internal function to count a failed response in the link statistics
  *
- * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param range Pointer to float variable that will receive the maximum range in meters
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for response
+ * @param result Result of one response evaluation
+ */
+void iSYS4001::countResult(iSYSResult_t result)
+{
+    switch (result)
+    {
+    case ERR_INVALID_CHECKSUM:
+        _linkStats.checksumFailures++;
+        break;
+    case ERR_FRAME_INCOMPLETE:
+        _linkStats.incompleteFrames++;
+        break;
+    case ERR_COMMAND_RX_FRAME_DAMAGED:
+        _linkStats.damagedFrames++;
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Internal function to check whether a received frame answers the pending request
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_NULL_POINTER: range pointer is null
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ * @param frame Complete frame delivered by the frame parser
+ * @param length Frame length in bytes
  *
- * @note The function automatically converts from 0.1m fixed-point format to meters (divide by 10)
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @return bool true if the frame is addressed to the master, carries the expected
+ *         function code and comes from the addressed device, false otherwise
  *
- * @example
- *   // Get current maximum range for output 1
- *   float maxRange = 0;
- *   iSYSResult_t res = radar.iSYS_getOutputRangeMax(ISYS_OUTPUT_1, &maxRange, 0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.print("Current maximum range: ");
- *       Serial.print(maxRange);
- *       Serial.println(" meters");
- *   }
+ * @note The device address query is answered by a device whose address is not yet
+ *       known, so the source address is not compared for it (nor for requests sent to
+ *       the broadcast address 0x00).
  */
-iSYSResult_t iSYS4001::iSYS_getOutputRangeMax(iSYSOutputNumber_t outputnumber, float *range, uint8_t destAddress, uint32_t timeout)
+bool iSYS4001::matchesResponse(const uint8_t *frame, uint16_t length)
 {
-    if (range == NULL)
+    const uint8_t addressIndex = (frame[0] == ISYS_FRAME_SD2) ? 4 : 1;
+
+    // Only 32-bit target lists use the long frame layout
+    if (frame[0] != ISYS_FRAME_SD2 && _transaction.type != ISYS_RESPONSE_TARGET_LIST_32)
     {
-        return ERR_NULL_POINTER;
+        return false;
     }
 
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
+    if (length < (uint16_t)(addressIndex + 3) || frame[addressIndex] != ISYS_FRAME_MASTER_ADDRESS ||
+        frame[addressIndex + 2] != _transaction.functionCode)
     {
-        return ERR_OUTPUT_OUT_OF_RANGE;
+        return false;
     }
 
-    if (timeout == 0)
+    if (_transaction.type != ISYS_RESPONSE_DEVICE_ADDRESS && _transaction.sourceAddress != 0x00 &&
+        frame[addressIndex + 1] != _transaction.sourceAddress)
     {
-        return ERR_TIMEOUT;
+        return false;
     }
 
-    uint8_t command[11];
-    uint8_t index = 0;
-
-    command[index++] = 0x68;
-    command[index++] = 0x05;
-    command[index++] = 0x05;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD4;
-    command[index++] = outputnumber;
-    command[index++] = 0x09;
-
-    uint8_t fcs = calculateFCS(command, 4, 8);
-    command[index++] = fcs;
-    command[index++] = 0x16;
+    return true;
+}
 
-    debugPrintHexFrame("Sending GET Range Max command: ", command, sizeof(command));
+/**
+ * @brief Internal function to report why a transaction timed out
+ *
+ * @return iSYSResult_t Error code matching what was (not) received:
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Only frames not matching the request arrived
+ *         - ERR_FRAME_INCOMPLETE: Target list reception stopped mid-frame
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Acknowledgement/value reception stopped mid-frame
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: Nothing usable was received
+ */
+iSYSResult_t iSYS4001::timeoutResult()
+{
+    if (_parser.bufferedLength() > 0)
+    {
+        debugPrintHexFrame(_transaction.debugLabel, _parser.frame(), _parser.bufferedLength());
+        captureFrame(ISYS_CAPTURE_RX_PARTIAL, _parser.frame(), _parser.bufferedLength());
 
-    size_t bytesWritten = _serial.write(command, 11);
-    _serial.flush();
+        if (_transaction.type == ISYS_RESPONSE_TARGET_LIST_16 || _transaction.type == ISYS_RESPONSE_TARGET_LIST_32)
+        {
+            return ERR_FRAME_INCOMPLETE;
+        }
+        return ERR_COMMAND_RX_FRAME_LENGTH;
+    }
 
-    if (bytesWritten != sizeof(command))
+    if (_transaction.unrelatedFrame)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        return ERR_COMMAND_RX_FRAME_DAMAGED;
     }
 
-    uint8_t response[11];
-    uint32_t startTime = millis();
-    uint8_t rIdx = 0;
-    while ((millis() - startTime) < timeout && rIdx < 11)
+    return ERR_COMMAND_NO_DATA_RECEIVED;
+}
+
+/**
+ * @brief Internal function to validate and decode the response frame
+ *
+ * Applies the same checks the blocking API has always applied (length, payload
+ * structure, FCS) to the frame and writes the decoded value to the transaction's
+ * output pointer. Delimiters, length fields and addresses have already been
+ * checked by the frame parser and matchesResponse().
+ *
+ * @param response Complete response frame
+ * @param rxLength Frame length in bytes
+ *
+ * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame length does not fit the request
+ *         - ERR_FRAME_INCOMPLETE: Target list frame shorter than its target count requires
+ *         - ERR_COMMAND_MAX_DATA_OVERFLOW: Target list reports too many targets
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ */
+iSYSResult_t iSYS4001::evaluateResponse(const uint8_t *response, uint16_t rxLength)
+{
+    const iSYSResponseType_t type = _transaction.type;
+
+    debugPrintHexFrame(_transaction.debugLabel, response, rxLength);
+
+    if (type == ISYS_RESPONSE_TARGET_LIST_16 || type == ISYS_RESPONSE_TARGET_LIST_32)
     {
-        if (_serial.available())
+        const uint8_t bitrate = (type == ISYS_RESPONSE_TARGET_LIST_32) ? 32 : 16;
+
+        switch (_transaction.targetLayout)
         {
-            response[rIdx++] = _serial.read();
-            if (response[rIdx - 1] == 0x16)
-                break;
+        case ISYS_TARGET_LAYOUT_ARRAYS:
+            return evaluateTargetList((iSYSTargetArrays_t *)_transaction.output, response, rxLength, bitrate);
+        case ISYS_TARGET_LAYOUT_FIXED:
+            return evaluateTargetList((iSYSTargetListFixed_t *)_transaction.output, response, rxLength, bitrate);
+        default:
+            return evaluateTargetList((iSYSTargetList_t *)_transaction.output, response, rxLength, bitrate);
         }
     }
 
-    debugPrintHexFrame("Received Range Max response: ", response, rIdx);
-
-    if (rIdx == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
+    const uint8_t expectedLength = (type == ISYS_RESPONSE_ACK) ? 9 : 11;
 
-    if (rIdx < 11)
+    if (rxLength != expectedLength)
     {
         return ERR_COMMAND_RX_FRAME_LENGTH;
     }
 
-    if (response[0] != 0x68 || response[1] != 0x05 || response[2] != 0x05 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD4 || response[10] != 0x16)
+    if ((type == ISYS_RESPONSE_DIRECTION || type == ISYS_RESPONSE_FILTER_TYPE || type == ISYS_RESPONSE_SIGNAL_FILTER) &&
+        response[7] != 0x00)
     {
         return ERR_COMMAND_RX_FRAME_DAMAGED;
     }
 
-    uint8_t expectedFCS = calculateFCS(response, 4, 8);
-    if (response[9] != expectedFCS)
+    uint8_t expectedFCS = calculateFCS(response, 4, expectedLength - 3);
+    if (response[expectedLength - 2] != expectedFCS)
     {
         return ERR_INVALID_CHECKSUM;
     }
 
-    uint16_t rawRange = (response[7] << 8) | response[8];
-    *range = (float)rawRange / 10.0f; // return in m(meters)
+    if (type == ISYS_RESPONSE_ACK)
+    {
+        return ERR_OK;
+    }
+
+    uint16_t rawValue = ((uint16_t)response[7] << 8) | (uint16_t)response[8];
+    _transaction.cacheValue = rawValue;
+    decodeParameterValue(type, rawValue, _transaction.output);
 
     return ERR_OK;
 }
 
-/***************************************************************
- *  SET/GET VELOCITY MIN/MAX FUNCTIONS
- ***************************************************************/
-
 /**
- * @brief Set the minimum velocity threshold for a specified output channel
- *
- * Configures the minimum velocity threshold for the specified output channel
- * on the iSYS-4001 radar device. The velocity value is provided in km/h and is
- * automatically converted to the device's internal m/s format with 0.1m/s precision.
- *
- * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param velocity Minimum velocity in km/h (0 to 249.9)
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
- *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_PARAMETER_OUT_OF_RANGE: Velocity value outside valid limits
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ * @brief Internal function to decode a target list response into the transaction output
  *
- * @note The function automatically converts km/h to m/s: scaled = round((kmh / 3.6) * 10)
- * @note Changes take effect immediately but should be saved with saveApplicationSettings()
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @param pTargetList Transaction output, of the type recorded in _transaction.targetLayout
+ * @param response Complete response frame
+ * @param rxLength Number of bytes in the frame
+ * @param bitrate Data precision: 16 for 16-bit format, 32 for 32-bit format
  *
- * @example
- *   // Set minimum velocity to 5 km/h for output 1
- *   iSYSResult_t res = radar.iSYS_setOutputVelocityMin(ISYS_OUTPUT_1, 5, 0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.println("Minimum velocity set successfully");
- *   }
+ * @return iSYSResult_t Result of checkAndDecodeTargetList(); clipping frames are counted
+ *         in the link statistics
  */
-iSYSResult_t iSYS4001::iSYS_setOutputVelocityMin(iSYSOutputNumber_t outputnumber, uint16_t velocity, uint8_t destAddress, uint32_t timeout)
+template <typename TargetList>
+iSYSResult_t iSYS4001::evaluateTargetList(TargetList *pTargetList, const uint8_t *response, uint16_t rxLength, uint8_t bitrate)
 {
+    iSYSResult_t result = checkAndDecodeTargetList(response, rxLength, bitrate, _parser.frameChecksumValid(), pTargetList);
 
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
+    if (result == ERR_OK && pTargetList->clippingFlag)
     {
-        return ERR_OUTPUT_OUT_OF_RANGE;
+        _linkStats.clippingEvents++;
     }
+    return result;
+}
 
-    if (velocity < 0.0 || velocity >= 250.0)
-    {
-        return ERR_PARAMETER_OUT_OF_RANGE;
-    }
+/**
+ * @brief Internal functions to record which structure a target list transaction fills
+ *
+ * @return iSYSTargetLayout_t Layout stored in _transaction.targetLayout for evaluateResponse()
+ */
+iSYS4001::iSYSTargetLayout_t iSYS4001::targetLayout(const iSYSTargetList_t *)
+{
+    return ISYS_TARGET_LAYOUT_LIST;
+}
 
-    if (timeout == 0)
+iSYS4001::iSYSTargetLayout_t iSYS4001::targetLayout(const iSYSTargetArrays_t *)
+{
+    return ISYS_TARGET_LAYOUT_ARRAYS;
+}
+
+iSYS4001::iSYSTargetLayout_t iSYS4001::targetLayout(const iSYSTargetListFixed_t *)
+{
+    return ISYS_TARGET_LAYOUT_FIXED;
+}
+
+/***************************************************************
+ *  GET TARGET LIST FUNCTIONS
+ ***************************************************************/
+
+/*
+ * Layout adapters for the shared target list decoder: decodeTargetFrame() reaches the
+ * fields of iSYSTargetList_t, iSYSTargetArrays_t or iSYSTargetListFixed_t only through
+ * clearTargetList(), clearTargets(), decodeRecords16() and decodeRecords32(). The float
+ * layouts hand the records to the run-time selected kernels of iSYSTargetDecoder.
+ */
+static_assert(sizeof(iSYSTarget_t) == 4 * sizeof(float) && offsetof(iSYSTarget_t, signal) == 0 &&
+                  offsetof(iSYSTarget_t, velocity) == 4 && offsetof(iSYSTarget_t, range) == 8 && offsetof(iSYSTarget_t, angle) == 12,
+              "iSYSTarget_t must match the interleaved layout of iSYSDecodeTargets16/32()");
+
+/*
+ * Reset a list before a request, a decodeTargetList() call or the end of a stream cycle:
+ * without zero fill only the header, so a list that fails to arrive reads as empty
+ * without rewriting all MAX_TARGETS entries.
+ */
+template <typename TargetList>
+static inline void clearTargetList(TargetList *targetList, bool zeroFill)
+{
+    if (zeroFill)
     {
-        return ERR_TIMEOUT;
+        memset(targetList, 0, sizeof(TargetList));
+        return;
     }
 
-    uint8_t command[13];
-    uint8_t index = 0;
-    uint16_t scaledVelocity = (uint16_t)round((velocity / 3.6f) * 10.0f);
-    uint8_t minHighByte = (scaledVelocity >> 8) & 0xFF;
-    uint8_t minLowByte = scaledVelocity & 0xFF;
-
-    command[index++] = 0x68;
-    command[index++] = 0x07;
-    command[index++] = 0x07;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD5;
-    command[index++] = outputnumber;
-    command[index++] = 0x0C;
-    command[index++] = minHighByte;
-    command[index++] = minLowByte;
+    targetList->error.dummy = 0;
+    targetList->outputNumber = 0;
+    targetList->nrOfTargets = 0;
+    targetList->clippingFlag = 0;
+}
 
-    uint8_t fcs = calculateFCS(command, 4, 10);
+// Clear the entries past the decoded ones (first = nrOfTargets), only with zero fill
+static inline void clearTargets(iSYSTargetList_t *targetList, uint8_t first, bool zeroFill)
+{
+    if (!zeroFill)
+    {
+        return;
+    }
 
-    command[11] = fcs;
-    command[12] = 0x16;
+    for (uint8_t i = first; i < MAX_TARGETS; i++)
+    {
+        targetList->targets[i].angle = 0;
+        targetList->targets[i].range = 0;
+        targetList->targets[i].signal = 0;
+        targetList->targets[i].velocity = 0;
+    }
+}
 
-    debugPrintHexFrame("Sending SET velocity min command to radar: ", command, 13);
+static inline void decodeRecords16(iSYSTargetList_t *targetList, const uint8_t *records, uint8_t count)
+{
+    iSYSDecodeTargets16(records, count, &targetList->targets[0].signal);
+}
 
-    size_t bytesWritten = _serial.write(command, 13);
-    _serial.flush();
+static inline void decodeRecords32(iSYSTargetList_t *targetList, const uint8_t *records, uint8_t count)
+{
+    iSYSDecodeTargets32(records, count, &targetList->targets[0].signal);
+}
 
-    if (bytesWritten != 13)
+static inline void clearTargets(iSYSTargetArrays_t *targetArrays, uint8_t first, bool zeroFill)
+{
+    // Always up to the next whole 4-float vector, so vector loops over nrOfTargets read zeros past the list
+    const uint8_t last = zeroFill ? ISYS_TARGET_ARRAY_CAPACITY : (uint8_t)((first + 3) & ~3);
+    for (uint8_t i = first; i < last; i++)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        targetArrays->signal[i] = 0;
+        targetArrays->velocity[i] = 0;
+        targetArrays->range[i] = 0;
+        targetArrays->angle[i] = 0;
     }
+}
 
-    uint8_t response[9];
-    size_t minIndex = 0;
-    uint32_t startTime = millis();
+static inline void decodeRecords16(iSYSTargetArrays_t *targetArrays, const uint8_t *records, uint8_t count)
+{
+    iSYSDecodeColumns16(records, count, targetArrays->signal, targetArrays->velocity, targetArrays->range, targetArrays->angle);
+}
 
-    while ((millis() - startTime) < timeout && minIndex < sizeof(response))
-    {
-        if (_serial.available())
-        {
-            response[minIndex++] = _serial.read();
+static inline void decodeRecords32(iSYSTargetArrays_t *targetArrays, const uint8_t *records, uint8_t count)
+{
+    iSYSDecodeColumns32(records, count, targetArrays->signal, targetArrays->velocity, targetArrays->range, targetArrays->angle);
+}
 
-            if (response[minIndex - 1] == 0x16)
-                break;
-        }
+// Fixed-point layout: 32-bit records already use its units, 16-bit records need one integer multiply
+static inline void clearTargets(iSYSTargetListFixed_t *targetList, uint8_t first, bool zeroFill)
+{
+    if (!zeroFill)
+    {
+        return;
     }
 
-    debugPrintHexFrame("Received SET velocity min acknowledgement: ", response, minIndex);
-
-    if (minIndex == 0)
+    for (uint8_t i = first; i < MAX_TARGETS; i++)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        targetList->targets[i].signal = 0;
+        targetList->targets[i].velocity = 0;
+        targetList->targets[i].range = 0;
+        targetList->targets[i].angle = 0;
     }
+}
 
-    if (minIndex < 9)
+static inline void decodeRecords16(iSYSTargetListFixed_t *targetList, const uint8_t *records, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++, records += 7)
     {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
+        targetList->targets[i].signal = (int16_t)(records[0] * 100);
+        targetList->targets[i].velocity = (int32_t)iSYSReadInt16(&records[1]) * 10;
+        targetList->targets[i].range = (int32_t)iSYSReadInt16(&records[3]) * 10000;
+        targetList->targets[i].angle = iSYSReadInt16(&records[5]);
     }
+}
 
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD5 || response[8] != 0x16)
+static inline void decodeRecords32(iSYSTargetListFixed_t *targetList, const uint8_t *records, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++, records += 14)
     {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
+        targetList->targets[i].signal = iSYSReadInt16(&records[0]);
+        targetList->targets[i].velocity = iSYSReadInt32(&records[2]);
+        targetList->targets[i].range = iSYSReadInt32(&records[6]);
+        targetList->targets[i].angle = iSYSReadInt32(&records[10]);
     }
+}
 
-    if (minIndex >= 9)
+/*
+ * Data format of a raw target list frame: 32-bit long frames start with a delimiter
+ * other than 0x68; an SD2 frame is 16-bit when its length matches 7 bytes per target.
+ */
+static uint8_t targetListBitrate(const uint8_t *frame, uint16_t length)
+{
+    if (frame[0] == ISYS_FRAME_SD2 && length >= 11)
     {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
+        // SD2: 9 byte header, FCS and end delimiter; 16-bit lists carry 7 bytes per target
+        const uint8_t nrOfTargets = frame[8];
+        const uint8_t nrOfRecords = (nrOfTargets == 0xFF) ? 0 : nrOfTargets;
+        if (length == 11 + (7 * nrOfRecords))
         {
-            return ERR_INVALID_CHECKSUM;
+            return 16;
         }
     }
-    return ERR_OK;
+    return 32;
 }
 
 /**
- * @brief Set the maximum velocity threshold for a specified output channel
+ * @brief Choose whether target list entries past nrOfTargets are cleared
  *
- * Configures the maximum velocity threshold for the specified output channel
- * on the iSYS-4001 radar device. The velocity value is provided in km/h and is
- * automatically converted to the device's internal m/s format with 0.1m/s precision.
+ * By default a decode writes only the nrOfTargets valid entries, and a request only
+ * resets the list header. Entries past nrOfTargets keep the values of an earlier,
+ * longer list. For a sparse scene this saves rewriting the whole ~570-byte list on
+ * every poll. iSYSTargetArrays_t columns are still cleared up to the next multiple
+ * of 4, so vector loops over nrOfTargets read zeros past the list.
  *
- * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param velocity Maximum velocity in km/h (0.5 to 250.0)
+ * With zero fill enabled the driver behaves as earlier releases: every request clears
+ * the whole structure and every decode clears all entries past nrOfTargets, padding
+ * included.
+ *
+ * @param enabled true to clear the unused entries, false (the default) to leave them
+ *
+ * @note Loops that stop at nrOfTargets are not affected. Enable zero fill for code
+ *       that scans all MAX_TARGETS entries and treats zeros as "no target".
+ *
+ * @example
+ *   radar.setTargetListZeroFill(true);
+ *   radar.getTargetList32(&targetList, 0x80, 300); // targets[nrOfTargets..] are 0
+ */
+void iSYS4001::setTargetListZeroFill(bool enabled)
+{
+    _zeroFill = enabled;
+}
+
+/**
+ * @brief Whether target list entries past nrOfTargets are cleared
+ *
+ * @return bool true if zero fill is enabled (see setTargetListZeroFill())
+ */
+bool iSYS4001::getTargetListZeroFill()
+{
+    return _zeroFill;
+}
+
+/**
+ * @brief Retrieve 16-bit target list from radar device
+ *
+ * Requests and receives a list of detected targets from the iSYS-4001 radar
+ * using the 16-bit data format. The function first sends a target list request
+ * to the specified output channel, then waits for and parses the response into
+ * the provided iSYSTargetList_t structure.
+ *
+ * @param pTargetList Pointer to iSYSTargetList_t structure that will receive the target list data
  * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ * @param timeout Maximum time in milliseconds to wait for target list response
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_PARAMETER_OUT_OF_RANGE: Velocity value outside valid limits
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response received within timeout
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame shorter than expected
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
  *
- * @note The function automatically converts km/h to m/s: scaled = round((kmh / 3.6) * 10)
- * @note Changes take effect immediately but should be saved with saveApplicationSettings()
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @note The header of the list is reset before the request, so a failed call leaves an
+ *       empty list. Entries past nrOfTargets are only cleared with setTargetListZeroFill(true).
+ * @note Internally, this calls sendTargetListRequest() and receiveTargetListResponse().
+ * @note In non-blocking mode (see setNonBlocking()) the call returns ERR_TRANSACTION_PENDING
+ *       after sending the request; pTargetList is filled by a later poll() and must stay valid
+ *       until the transaction completes.
  *
  * @example
- *   // Set maximum velocity to 120 km/h for output 1
- *   iSYSResult_t res = radar.iSYS_setOutputVelocityMax(ISYS_OUTPUT_1, 120, 0x80, 300);
+ *   // Get 16-bit target list from output 1
+ *   iSYSTargetList_t targetList;
+ *   iSYSResult_t res = radar.getTargetList16(&targetList, 0x80, 300, ISYS_OUTPUT_1);
  *   if (res == ERR_OK) {
- *       Serial.println("Maximum velocity set successfully");
+ *       Serial.print("Number of targets: ");
+ *       Serial.println(targetList.count);
+ *   } else {
+ *       Serial.print("Failed to get target list, error: ");
+ *       Serial.println(res);
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_setOutputVelocityMax(iSYSOutputNumber_t outputnumber, uint16_t velocity, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::getTargetList16(iSYSTargetList_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
 {
-
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
-    {
-        return ERR_OUTPUT_OUT_OF_RANGE;
-    }
-
-    if (velocity < 0.5 || velocity > 250.0)
-    {
-        return ERR_PARAMETER_OUT_OF_RANGE;
-    }
-
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    uint8_t command[13];
-    uint8_t index = 0;
-    uint16_t scaledVelocity = (uint16_t)round((velocity / 3.6f) * 10.0f);
-    uint8_t maxHighByte = (scaledVelocity >> 8) & 0xFF;
-    uint8_t maxLowByte = scaledVelocity & 0xFF;
-
-    command[index++] = 0x68;
-    command[index++] = 0x07;
-    command[index++] = 0x07;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD5;
-    command[index++] = outputnumber;
-    command[index++] = 0x0D;
-    command[index++] = maxHighByte;
-    command[index++] = maxLowByte;
-
-    // Calculate checksum (sum of bytes 4 to 10)
-    uint8_t fcs = calculateFCS(command, 4, 10);
-
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Sending SET velocity max command to radar: ", command, 13);
-
-    size_t bytesWritten = _serial.write(command, 13);
-    _serial.flush();
-
-    if (bytesWritten != 13)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    uint8_t response[9];
-    uint32_t startTime = millis();
-    size_t maxIndex = 0;
-
-    while ((millis() - startTime) < timeout && maxIndex < 9)
-    {
-        if (_serial.available())
-        {
-            response[maxIndex++] = _serial.read();
-            if (response[maxIndex - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received SET velocity max acknowledgement: ", response, maxIndex);
-
-    if (maxIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    if (maxIndex < 9)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
-
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD5 || response[8] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
-
-    if (maxIndex == 9)
-    {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
-    }
-
-    return ERR_OK;
+    return getTargetList(pTargetList, destAddress, timeout, outputnumber, 16);
 }
 
 /**
- * @brief Get the current minimum velocity threshold for a specified output channel
+ * @brief Retrieve 32-bit target list from radar device
  *
- * Retrieves the current minimum velocity threshold for the specified output channel
- * from the iSYS-4001 radar device. The velocity value is returned in km/h after automatic
- * conversion from the device's internal m/s format.
+ * Requests and receives a list of detected targets from the iSYS-4001 radar
+ * using the 32-bit data format. The function first sends a target list request
+ * to the specified output channel, then waits for and parses the response into
+ * the provided iSYSTargetList_t structure.
  *
- * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param velocity Pointer to float variable that will receive the minimum velocity in km/h
+ * @param pTargetList Pointer to iSYSTargetList_t structure that will receive the target list data
  * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for response
+ * @param timeout Maximum time in milliseconds to wait for target list response
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_NULL_POINTER: velocity pointer is null
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response received within timeout
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame shorter than expected
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
  *
- * @note The function automatically converts from m/s to km/h: kmh = (raw / 10) * 3.6
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @note The header of the list is reset before the request, so a failed call leaves an
+ *       empty list. Entries past nrOfTargets are only cleared with setTargetListZeroFill(true).
+ * @note Internally, this calls sendTargetListRequest() and receiveTargetListResponse().
+ * @note In non-blocking mode (see setNonBlocking()) the call returns ERR_TRANSACTION_PENDING
+ *       after sending the request; pTargetList is filled by a later poll() and must stay valid
+ *       until the transaction completes.
  *
  * @example
- *   // Get current minimum velocity for output 1
- *   float minVelocity = 0;
- *   iSYSResult_t res = radar.iSYS_getOutputVelocityMin(ISYS_OUTPUT_1, &minVelocity, 0x80, 300);
+ *   // Get 32-bit target list from output 2
+ *   iSYSTargetList_t targetList;
+ *   iSYSResult_t res = radar.getTargetList32(&targetList, 0x80, 300, ISYS_OUTPUT_2);
  *   if (res == ERR_OK) {
- *       Serial.print("Current minimum velocity: ");
- *       Serial.print(minVelocity);
- *       Serial.println(" km/h");
+ *       Serial.print("Number of targets: ");
+ *       Serial.println(targetList.count);
+ *   } else {
+ *       Serial.print("Failed to get target list, error: ");
+ *       Serial.println(res);
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_getOutputVelocityMin(iSYSOutputNumber_t outputnumber, float *velocity, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::getTargetList32(iSYSTargetList_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
 {
-    if (velocity == NULL)
-        return ERR_NULL_POINTER;
+    return getTargetList(pTargetList, destAddress, timeout, outputnumber, 32);
+}
 
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
-    {
-        return ERR_OUTPUT_OUT_OF_RANGE;
-    }
+/**
+ * @brief Retrieve 16-bit target list from radar device into one array per field
+ *
+ * Same request and result codes as getTargetList16(iSYSTargetList_t *, ...), but the
+ * targets are decoded straight into the columns of an iSYSTargetArrays_t.
+ *
+ * @param pTargetArrays Pointer to iSYSTargetArrays_t structure that will receive the target list data
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for target list response
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ *
+ * @return iSYSResult_t ERR_OK on success, or the error codes of getTargetList16()
+ *
+ * @example
+ *   static iSYSTargetArrays_t targets;
+ *   if (radar.getTargetList16(&targets, 0x80, 300, ISYS_OUTPUT_1) == ERR_OK) {
+ *       Serial.println(targets.range[0]);
+ *   }
+ */
+iSYSResult_t iSYS4001::getTargetList16(iSYSTargetArrays_t *pTargetArrays, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
+{
+    return getTargetList(pTargetArrays, destAddress, timeout, outputnumber, 16);
+}
 
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
+/**
+ * @brief Retrieve 32-bit target list from radar device into one array per field
+ *
+ * Same request and result codes as getTargetList32(iSYSTargetList_t *, ...), but the
+ * targets are decoded straight into the columns of an iSYSTargetArrays_t.
+ *
+ * @param pTargetArrays Pointer to iSYSTargetArrays_t structure that will receive the target list data
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for target list response
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ *
+ * @return iSYSResult_t ERR_OK on success, or the error codes of getTargetList32()
+ */
+iSYSResult_t iSYS4001::getTargetList32(iSYSTargetArrays_t *pTargetArrays, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
+{
+    return getTargetList(pTargetArrays, destAddress, timeout, outputnumber, 32);
+}
 
-    uint8_t command[11];
-    uint8_t index = 0;
-    command[index++] = 0x68;
-    command[index++] = 0x05;
-    command[index++] = 0x05;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD4;
-    command[index++] = outputnumber;
-    command[index++] = 0x0C;
-    uint8_t fcs = calculateFCS(command, 4, 8);
-    command[index++] = fcs;
-    command[index++] = 0x16;
+/**
+ * @brief Retrieve 16-bit target list from radar device in integer fixed-point units
+ *
+ * Same request and result codes as getTargetList16(iSYSTargetList_t *, ...), but the
+ * targets are stored in the units of iSYSTargetFixed_t without any float arithmetic.
+ *
+ * @param pTargetList Pointer to iSYSTargetListFixed_t structure that will receive the target list data
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for target list response
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ *
+ * @return iSYSResult_t ERR_OK on success, or the error codes of getTargetList16()
+ *
+ * @example
+ *   iSYSTargetListFixed_t targets;
+ *   if (radar.getTargetList16(&targets, 0x80, 300) == ERR_OK && targets.nrOfTargets > 0) {
+ *       Serial.println(targets.targets[0].range / 10000); // cm
+ *   }
+ */
+iSYSResult_t iSYS4001::getTargetList16(iSYSTargetListFixed_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
+{
+    return getTargetList(pTargetList, destAddress, timeout, outputnumber, 16);
+}
+
+/**
+ * @brief Retrieve 32-bit target list from radar device in integer fixed-point units
+ *
+ * Same request and result codes as getTargetList32(iSYSTargetList_t *, ...). The
+ * 32-bit format already uses the units of iSYSTargetFixed_t, so decoding is a
+ * byte swap per field.
+ *
+ * @param pTargetList Pointer to iSYSTargetListFixed_t structure that will receive the target list data
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for target list response
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ *
+ * @return iSYSResult_t ERR_OK on success, or the error codes of getTargetList32()
+ */
+iSYSResult_t iSYS4001::getTargetList32(iSYSTargetListFixed_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
+{
+    return getTargetList(pTargetList, destAddress, timeout, outputnumber, 32);
+}
+
+/**
+ * @brief Internal function to request a target list and receive it into any layout
+ *
+ * @param pTargetList iSYSTargetList_t, iSYSTargetArrays_t or iSYSTargetListFixed_t that receives the decoded list
+ * @param destAddress Device Radar Destination address
+ * @param timeout Maximum time in milliseconds to wait for the response
+ * @param outputnumber Output channel to query
+ * @param bitrate Data precision: 16 for 16-bit format, 32 for 32-bit format
+ *
+ * @return iSYSResult_t ERR_OK on success, or error code on failure
+ */
+template <typename TargetList>
+iSYSResult_t iSYS4001::getTargetList(TargetList *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber, uint8_t bitrate)
+{
+    iSYSResult_t res = sendTargetListRequest(outputnumber, destAddress, bitrate);
+    if (res != ERR_OK)
+        return res;
+    clearTargetList(pTargetList, _zeroFill);
+    return receiveTargetListResponse(pTargetList, targetLayout(pTargetList), destAddress, timeout, bitrate);
+}
 
-    debugPrintHexFrame("Sending GET Velocity min command: ", command, sizeof(command));
+/***************************************************************
+ *  TARGET LIST STREAMING FUNCTIONS
+ ***************************************************************/
 
-    size_t bytesWritten = _serial.write(command, sizeof(command));
-    _serial.flush();
+/**
+ * @brief Start continuous 16-bit target list acquisition
+ *
+ * Sends the first target list request and returns immediately. From then on each
+ * poll() that completes a response sends the request for the next list before
+ * decoding the current one, so the decoding overlaps with the sensor's reply time
+ * and there is no idle gap on the line between cycles.
+ *
+ * @param pTargetList Pointer to iSYSTargetList_t structure that receives every decoded list
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for each response
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ *
+ * @return iSYSResult_t ERR_OK when the stream is running, or error code for failure conditions:
+ *         - ERR_NULL_POINTER: pTargetList is NULL
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_TRANSACTION_BUSY: Another transaction is still pending
+ *
+ * @note Works in both blocking and non-blocking mode; the stream is always driven by poll().
+ * @note pTargetList is only written inside poll() and must stay valid until the stream stops.
+ * @note While streaming, all other requests return ERR_TRANSACTION_BUSY.
+ * @note A timed-out cycle is reported through getTransactionResult() and the stream continues.
+ *
+ * @example
+ *   radar.startTargetListStream16(&targetList, 0x80, 300, ISYS_OUTPUT_1);
+ *   void loop() {
+ *       if (radar.poll() == ISYS_TRANSACTION_COMPLETE && radar.getTransactionResult() == ERR_OK) {
+ *           Serial.println(targetList.nrOfTargets);
+ *       }
+ *   }
+ */
+iSYSResult_t iSYS4001::startTargetListStream16(iSYSTargetList_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
+{
+    return startTargetListStream(pTargetList, destAddress, timeout, outputnumber, 16);
+}
+
+/**
+ * @brief Start continuous 32-bit target list acquisition
+ *
+ * Same as startTargetListStream16() but requests the high-precision 32-bit format.
+ *
+ * @param pTargetList Pointer to iSYSTargetList_t structure that receives every decoded list
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for each response
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ *
+ * @return iSYSResult_t ERR_OK when the stream is running, or error code for failure conditions:
+ *         - ERR_NULL_POINTER: pTargetList is NULL
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_TRANSACTION_BUSY: Another transaction is still pending
+ *
+ * @note At 115200 baud a 35-target 32-bit list takes about 43 ms on the wire, so overlapping
+ *       the decode with the next request matters most for this format.
+ *
+ * @example
+ *   radar.startTargetListStream32(&targetList, 0x80, 300, ISYS_OUTPUT_1);
+ */
+iSYSResult_t iSYS4001::startTargetListStream32(iSYSTargetList_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
+{
+    return startTargetListStream(pTargetList, destAddress, timeout, outputnumber, 32);
+}
+
+/**
+ * @brief Start a 16-bit target list stream that decodes into one array per field
+ *
+ * Same as startTargetListStream16(iSYSTargetList_t *, ...) with an iSYSTargetArrays_t
+ * as destination.
+ *
+ * @return iSYSResult_t ERR_OK when the first request was sent, or the error codes of
+ *         startTargetListStream16()
+ */
+iSYSResult_t iSYS4001::startTargetListStream16(iSYSTargetArrays_t *pTargetArrays, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
+{
+    return startTargetListStream(pTargetArrays, destAddress, timeout, outputnumber, 16);
+}
+
+/**
+ * @brief Start a 32-bit target list stream that decodes into one array per field
+ *
+ * Same as startTargetListStream32(iSYSTargetList_t *, ...) with an iSYSTargetArrays_t
+ * as destination.
+ *
+ * @return iSYSResult_t ERR_OK when the first request was sent, or the error codes of
+ *         startTargetListStream32()
+ */
+iSYSResult_t iSYS4001::startTargetListStream32(iSYSTargetArrays_t *pTargetArrays, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
+{
+    return startTargetListStream(pTargetArrays, destAddress, timeout, outputnumber, 32);
+}
+
+/**
+ * @brief Start a 16-bit target list stream in integer fixed-point units
+ *
+ * Same as startTargetListStream16(iSYSTargetList_t *, ...) with an iSYSTargetListFixed_t
+ * as destination.
+ *
+ * @return iSYSResult_t ERR_OK when the first request was sent, or the error codes of
+ *         startTargetListStream16()
+ */
+iSYSResult_t iSYS4001::startTargetListStream16(iSYSTargetListFixed_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
+{
+    return startTargetListStream(pTargetList, destAddress, timeout, outputnumber, 16);
+}
+
+/**
+ * @brief Start a 32-bit target list stream in integer fixed-point units
+ *
+ * Same as startTargetListStream32(iSYSTargetList_t *, ...) with an iSYSTargetListFixed_t
+ * as destination.
+ *
+ * @return iSYSResult_t ERR_OK when the first request was sent, or the error codes of
+ *         startTargetListStream32()
+ */
+iSYSResult_t iSYS4001::startTargetListStream32(iSYSTargetListFixed_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber)
+{
+    return startTargetListStream(pTargetList, destAddress, timeout, outputnumber, 32);
+}
+
+/**
+ * @brief Stop continuous target list acquisition
+ *
+ * No further requests are sent. The request already on the wire completes normally:
+ * keep calling poll() until getTransactionState() is no longer ISYS_TRANSACTION_PENDING
+ * before issuing other commands.
+ *
+ * @return iSYSResult_t ERR_OK
+ *
+ * @example
+ *   radar.stopTargetListStream();
+ *   while (radar.poll() == ISYS_TRANSACTION_PENDING) {
+ *   }
+ *   radar.iSYS_stopAcquisition(0x80, 300);
+ */
+iSYSResult_t iSYS4001::stopTargetListStream()
+{
+    _stream.active = false;
+    return ERR_OK;
+}
+
+/**
+ * @brief Internal function to start a target list stream
+ *
+ * @param pTargetList iSYSTargetList_t, iSYSTargetArrays_t or iSYSTargetListFixed_t that receives every decoded list
+ * @param destAddress Device Radar Destination address
+ * @param timeout Maximum time in milliseconds to wait for each response
+ * @param outputnumber Output channel to query
+ * @param bitrate Data precision: 16 for 16-bit format, 32 for 32-bit format
+ *
+ * @return iSYSResult_t ERR_OK when the first request was sent, or error code on failure
+ */
+template <typename TargetList>
+iSYSResult_t iSYS4001::startTargetListStream(TargetList *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber, uint8_t bitrate)
+{
+    if (pTargetList == NULL)
+        return ERR_NULL_POINTER;
 
-    if (bytesWritten != sizeof(command))
+    if (timeout == 0)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        return ERR_TIMEOUT;
     }
 
-    uint8_t response[11];
-    uint32_t startTime = millis();
-    uint8_t rIdx = 0;
-    while ((millis() - startTime) < timeout && rIdx < 11)
+    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
     {
-        if (_serial.available())
-        {
-            response[rIdx++] = _serial.read();
-            if (response[rIdx - 1] == 0x16)
-                break;
-        }
+        return ERR_OUTPUT_OUT_OF_RANGE;
     }
 
-    debugPrintHexFrame("Received Velocity min response: ", response, rIdx);
+    iSYSResult_t res = sendTargetListRequest(outputnumber, destAddress, bitrate);
+    if (res != ERR_OK)
+        return res;
 
-    if (rIdx == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
+    clearTargetList(pTargetList, _zeroFill);
+    _parser.reset();
+    _transaction.targetLayout = targetLayout(pTargetList);
+    armTransaction((bitrate == 32) ? ISYS_RESPONSE_TARGET_LIST_32 : ISYS_RESPONSE_TARGET_LIST_16,
+                   0xDA, destAddress, pTargetList, timeout, "Received response from radar: ");
+    _transaction.streamCycle = true;
+
+    _stream.active = true;
+    _stream.outputnumber = outputnumber;
+    _stream.destAddress = destAddress;
+    _stream.bitrate = bitrate;
 
-    if (rIdx < 11)
+    return ERR_OK;
+}
+
+/**
+ * @brief Internal function to send the next streaming request and re-arm the transaction
+ *
+ * @return bool true if the request was sent and the transaction waits for its response,
+ *         false if sending failed (the stream is stopped)
+ *
+ * @note Called from poll() while the previous response is still in the frame buffer;
+ *       the transaction output, timeout and response type are kept from the previous cycle.
+ */
+bool iSYS4001::requestNextStreamFrame()
+{
+    // The previous request is answered, so sendFrame() must not report it as busy
+    _transaction.state = ISYS_TRANSACTION_COMPLETE;
+
+    if (sendTargetListRequest(_stream.outputnumber, _stream.destAddress, _stream.bitrate) != ERR_OK)
     {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
+        _stream.active = false;
+        return false;
     }
 
-    if (response[0] != 0x68 || response[1] != 0x05 || response[2] != 0x05 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD4 || response[10] != 0x16)
+    armTransaction(_transaction.type, _transaction.functionCode, _transaction.sourceAddress,
+                   _transaction.output, _transaction.timeoutLimit, _transaction.debugLabel);
+    _transaction.streamCycle = true;
+    return true;
+}
+
+/**
+ * @brief Internal function to reset the list of a stream cycle that just ended
+ *
+ * getTargetList16/32() reset the list header before every request; a stream only
+ * clears its list once in startTargetListStream16/32(). Resetting it when each cycle
+ * ends gives every cycle the same outcome as a blocking call: a failed or clipping
+ * cycle reports nrOfTargets = 0 instead of the previous cycle's targets.
+ *
+ * @note Does nothing for transactions other than stream cycles. The cycle that is still
+ *       pending when stopTargetListStream() is called counts as a stream cycle.
+ */
+void iSYS4001::resetStreamTargetList()
+{
+    if (!_transaction.streamCycle)
     {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
+        return;
     }
 
-    if (rIdx == 11)
+    switch (_transaction.targetLayout)
     {
-        uint8_t expectedFCS = calculateFCS(response, 4, 8);
-        if (response[9] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
+    case ISYS_TARGET_LAYOUT_ARRAYS:
+        clearTargetList((iSYSTargetArrays_t *)_transaction.output, _zeroFill);
+        break;
+    case ISYS_TARGET_LAYOUT_FIXED:
+        clearTargetList((iSYSTargetListFixed_t *)_transaction.output, _zeroFill);
+        break;
+    default:
+        clearTargetList((iSYSTargetList_t *)_transaction.output, _zeroFill);
+        break;
     }
-
-    uint16_t rawvelocity = ((uint16_t)response[7] << 8) | (uint16_t)response[8];
-    *velocity = ((float)rawvelocity / 10.0f) * 3.6f; // return in km/h
-
-    return ERR_OK;
 }
 
+// Target list requests for ISYS_PRECOMPUTED_ADDRESS, [output - 1][16-bit, 32-bit], built by the compiler
+static const uint8_t *const precomputedTargetListRequests[3][2] = {
+    {iSYSTargetListRequestFrame<ISYS_PRECOMPUTED_ADDRESS, ISYS_OUTPUT_1, 16>::bytes, iSYSTargetListRequestFrame<ISYS_PRECOMPUTED_ADDRESS, ISYS_OUTPUT_1, 32>::bytes},
+    {iSYSTargetListRequestFrame<ISYS_PRECOMPUTED_ADDRESS, ISYS_OUTPUT_2, 16>::bytes, iSYSTargetListRequestFrame<ISYS_PRECOMPUTED_ADDRESS, ISYS_OUTPUT_2, 32>::bytes},
+    {iSYSTargetListRequestFrame<ISYS_PRECOMPUTED_ADDRESS, ISYS_OUTPUT_3, 16>::bytes, iSYSTargetListRequestFrame<ISYS_PRECOMPUTED_ADDRESS, ISYS_OUTPUT_3, 32>::bytes}};
+
 /**
- * @brief Get the current maximum velocity threshold for a specified output channel
+ * @brief Internal function to send target list request command to radar device
  *
- * Retrieves the current maximum velocity threshold for the specified output channel
- * from the iSYS-4001 radar device. The velocity value is returned in km/h after automatic
- * conversion from the device's internal m/s format.
+ * Constructs and transmits a command frame to request target list data from
+ * the iSYS-4001 radar device. The command specifies the output channel and data
+ * precision (16-bit or 32-bit). This is an internal helper function used by
+ * getTargetList16() and getTargetList32().
  *
- * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param velocity Pointer to float variable that will receive the maximum velocity in km/h
+ * @param outputnumber Output channel to request data from (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
  * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for response
+ * @param bitrate Data precision: 16 for 16-bit format, 32 for 32-bit format
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_NULL_POINTER: velocity pointer is null
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ * @return iSYSResult_t ERR_OK on success, or error code if command transmission fails
  *
- * @note The function automatically converts from m/s to km/h: kmh = (raw / 10) * 3.6
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @note This function only sends the command - it does not wait for or process the response
+ * @note Used internally by getTargetList16() and getTargetList32() functions
+ * @note The command frame includes proper framing, address, and checksum validation
+ * @note Requests to ISYS_PRECOMPUTED_ADDRESS send a frame built at compile time (see iSYSFrames.h)
  *
  * @example
- *   // Get current maximum velocity for output 1
- *   float maxVelocity = 0;
- *   iSYSResult_t res = radar.iSYS_getOutputVelocityMax(ISYS_OUTPUT_1, &maxVelocity, 0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.print("Current maximum velocity: ");
- *       Serial.print(maxVelocity);
- *       Serial.println(" km/h");
+ *   // Internal usage - called by getTargetList16()
+ *   iSYSResult_t res = sendTargetListRequest(ISYS_OUTPUT_1, 0x80, 16);
+ *   if (res != ERR_OK) {
+ *       // Handle error
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_getOutputVelocityMax(iSYSOutputNumber_t outputnumber, float *velocity, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::sendTargetListRequest(iSYSOutputNumber_t outputnumber, uint8_t destAddress, uint8_t bitrate)
 {
-    if (velocity == NULL)
-        return ERR_NULL_POINTER;
-
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
-    {
-        return ERR_OUTPUT_OUT_OF_RANGE;
-    }
-
-    if (timeout == 0)
+    if (destAddress == ISYS_PRECOMPUTED_ADDRESS && outputnumber >= ISYS_OUTPUT_1 && outputnumber <= ISYS_OUTPUT_3)
     {
-        return ERR_TIMEOUT;
+        const uint8_t *frame = precomputedTargetListRequests[outputnumber - 1][(bitrate == 32) ? 1 : 0];
+        debugPrintHexFrame("Sending command to radar: ", frame, 11);
+        return sendFrame(frame, 11);
     }
 
     uint8_t command[11];
     uint8_t index = 0;
+
     command[index++] = 0x68;
     command[index++] = 0x05;
     command[index++] = 0x05;
     command[index++] = 0x68;
     command[index++] = destAddress;
     command[index++] = 0x01;
-    command[index++] = 0xD4;
+    command[index++] = 0xDA;
     command[index++] = outputnumber;
-    command[index++] = 0x0D;
-    uint8_t fcs = calculateFCS(command, 4, 8);
+    command[index++] = (bitrate == 32) ? 0x20 : 0x10; // 0x20 for 32-bit, 0x10 for 16-bit
+
+    uint8_t fcs = calculateFCS(command, 4, index - 1);
     command[index++] = fcs;
     command[index++] = 0x16;
 
-    debugPrintHexFrame("Sending GET Velocity max command: ", command, sizeof(command));
-
-    size_t bytesWritten = _serial.write(command, sizeof(command));
-    _serial.flush();
-
-    if (bytesWritten != sizeof(command))
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    uint8_t response[11];
-    uint32_t startTime = millis();
-    uint8_t rIdx = 0;
-    while ((millis() - startTime) < timeout && rIdx < 11)
-    {
-        if (_serial.available())
-        {
-            response[rIdx++] = _serial.read();
-            if (response[rIdx - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received Velocity max response: ", response, rIdx);
-
-    if (rIdx == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    if (rIdx < 11)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
-
-    if (response[0] != 0x68 || response[1] != 0x05 || response[2] != 0x05 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD4 || response[10] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
-
-    if (rIdx == 11)
-    {
-        uint8_t expectedFCS = calculateFCS(response, 4, 8);
-        if (response[9] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
-    }
+    debugPrintHexFrame("Sending command to radar: ", command, 11);
 
-    uint16_t rawvelocity = ((uint16_t)response[7] << 8) | (uint16_t)response[8];
-    *velocity = ((float)rawvelocity / 10.0f) * 3.6f; // return in km/h
+    return sendFrame(command, 11);
+}
 
-    return ERR_OK;
+/**
+ * @brief Internal function to receive and process target list response from radar device
+ *
+ * Waits for and receives the target list response frame from the iSYS-4001 radar device.
+ * The function handles the variable-length response based on the number of detected targets
+ * and the data precision (16-bit or 32-bit). It validates the frame structure and
+ * passes the data to decodeTargetFrame() for processing.
+ *
+ * @param pTargetList Pointer to target list structure that will receive the decoded data
+ * @param layout Structure pTargetList points to (see targetLayout())
+ * @param destAddress Address of the device the request was sent to
+ * @param timeout Maximum time in milliseconds to wait for the complete response
+ * @param bitrate Data precision: 16 for 16-bit format, 32 for 32-bit format
+ *
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response received before timeout
+ *         - ERR_FRAME_INCOMPLETE: Response frame was truncated
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Frame structure validation failed
+ *         - ERR_COMMAND_MAX_DATA_OVERFLOW: Too many targets in response
+ *         - ERR_INVALID_CHECKSUM: FCS does not match the frame contents; no targets are decoded
+ *
+ * @note This function handles the variable-length nature of target list responses
+ * @note Used internally by getTargetList16() and getTargetList32() functions
+ * @note The frame parser derives the expected response length from the frame header
+ * @note The frame is assembled in the instance-owned _rxBuffer (ISYS_MAX_FRAME_LENGTH bytes),
+ *       so polling target lists performs no dynamic memory allocation
+ * @note Reception is driven by poll(); see matchesResponse() and evaluateResponse()
+ *
+ * @example
+ *   // Internal usage - called by getTargetList32()
+ *   iSYSTargetList_t targets;
+ *   iSYSResult_t res = receiveTargetListResponse(&targets, ISYS_TARGET_LAYOUT_LIST, 0x80, 300, 32);
+ *   if (res != ERR_OK) {
+ *       // Handle communication error
+ *   }
+ */
+iSYSResult_t iSYS4001::receiveTargetListResponse(void *pTargetList, iSYSTargetLayout_t layout, uint8_t destAddress, uint32_t timeout, uint8_t bitrate)
+{
+    _transaction.targetLayout = layout;
+    iSYSResponseType_t type = (bitrate == 32) ? ISYS_RESPONSE_TARGET_LIST_32 : ISYS_RESPONSE_TARGET_LIST_16;
+    return awaitResponse(type, 0xDA, destAddress, pTargetList, timeout, "Received response from radar: ");
 }
 
-/***************************************************************
- *  SET/GET SIGNAL MIN/MAX FUNCTIONS
- ***************************************************************/
-
 /**
- * @brief Set the minimum signal strength threshold for a specified output channel
+ * @brief Decode a complete target list frame that was received outside the driver
  *
- * Configures the minimum signal strength threshold for the specified output channel
- * on the iSYS-4001 radar device. The signal value is provided in dB and is
- * automatically converted to the device's internal 0.1dB fixed-point format.
+ * Runs the same validation and decoding as getTargetList16/32() on a raw frame,
+ * e.g. one read back from a binary capture (see setCapture()) or received by
+ * another process. The data format follows from the frame: 32-bit long frames
+ * start with a delimiter other than 0x68, SD2 frames carry 7 (16-bit) or
+ * 14 (32-bit) bytes per target.
  *
- * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param signal Minimum signal strength in dB (0.0 to 249.9)
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ * @param frame Complete frame from the start delimiter to the end delimiter 0x16
+ * @param length Number of bytes in the frame
+ * @param pTargetList Pointer to target list structure to populate with decoded data
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_PARAMETER_OUT_OF_RANGE: Signal value outside valid limits
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ *         - ERR_NULL_POINTER: frame or pTargetList is nullptr
+ *         - ERR_FRAME_INCOMPLETE: Frame length does not match the target count
+ *         - ERR_COMMAND_MAX_DATA_OVERFLOW: Too many targets in the frame
+ *         - ERR_INVALID_CHECKSUM: FCS does not match the frame contents
+ *         - ERR_COMMAND_NO_VALID_FRAME_FOUND: End delimiter missing
  *
- * @note The function automatically converts dB to 0.1dB fixed-point format (multiply by 10)
- * @note Changes take effect immediately but should be saved with saveApplicationSettings()
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @note Sends nothing and does not touch a pending transaction; safe to call at any time.
+ * @note The list header is reset first, as getTargetList16/32() does before a request, so a
+ *       frame that fails the checks or reports clipping leaves nrOfTargets = 0.
  *
  * @example
- *   // Set minimum signal to 10 dB for output 1
- *   iSYSResult_t res = radar.iSYS_setOutputSignalMin(ISYS_OUTPUT_1, 10, 0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.println("Minimum signal threshold set successfully");
+ *   iSYSTargetList_t targetList;
+ *   if (radar.decodeTargetList(frame, frameLength, &targetList) == ERR_OK) {
+ *       Serial.println(targetList.nrOfTargets);
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_setOutputSignalMin(iSYSOutputNumber_t outputnumber, uint16_t signal, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::decodeTargetList(const uint8_t *frame, uint16_t length, iSYSTargetList_t *pTargetList)
 {
-
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
+    if (frame == nullptr || pTargetList == nullptr)
     {
-        return ERR_OUTPUT_OUT_OF_RANGE;
+        return ERR_NULL_POINTER;
     }
 
-    if (signal < 0.0 || signal > 249.9)
-    {
-        return ERR_PARAMETER_OUT_OF_RANGE;
-    }
+    clearTargetList(pTargetList, _zeroFill);
+    const bool checksumValid = (length >= 2) && (iSYSFrameParser::checksum(frame, length) == frame[length - 2]);
+    return checkAndDecodeTargetList(frame, length, targetListBitrate(frame, length), checksumValid, pTargetList);
+}
 
-    if (timeout == 0)
+/**
+ * @brief Decode a complete target list frame into one array per field
+ *
+ * Same as decodeTargetList(const uint8_t *, uint16_t, iSYSTargetList_t *) with an
+ * iSYSTargetArrays_t as destination.
+ *
+ * @param frame Complete frame from the start delimiter to the end delimiter 0x16
+ * @param length Number of bytes in the frame
+ * @param pTargetArrays Pointer to iSYSTargetArrays_t structure to populate with decoded data
+ *
+ * @return iSYSResult_t ERR_OK on success, or the error codes of decodeTargetList()
+ */
+iSYSResult_t iSYS4001::decodeTargetList(const uint8_t *frame, uint16_t length, iSYSTargetArrays_t *pTargetArrays)
+{
+    if (frame == nullptr || pTargetArrays == nullptr)
     {
-        return ERR_TIMEOUT;
+        return ERR_NULL_POINTER;
     }
 
-    uint8_t command[13];
-    uint8_t index = 0;
-    uint16_t scaledSignal = signal * 10;
-    uint8_t minHighByte = (scaledSignal >> 8) & 0xFF;
-    uint8_t minLowByte = scaledSignal & 0xFF;
+    clearTargetList(pTargetArrays, _zeroFill);
+    const bool checksumValid = (length >= 2) && (iSYSFrameParser::checksum(frame, length) == frame[length - 2]);
+    return checkAndDecodeTargetList(frame, length, targetListBitrate(frame, length), checksumValid, pTargetArrays);
+}
 
-    // Build command frame
-    command[index++] = 0x68;
-    command[index++] = 0x07;
-    command[index++] = 0x07;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD5;
-    command[index++] = outputnumber;
-    command[index++] = 0x0A;
-    command[index++] = minHighByte;
-    command[index++] = minLowByte;
+/**
+ * @brief Copy a target list from one array per field into the iSYSTargetList_t layout
+ *
+ * @param pTargetArrays Source list
+ * @param pTargetList Destination list; targets past nrOfTargets are cleared
+ *
+ * @example
+ *   iSYSTargetList_t targetList;
+ *   iSYS4001::targetArraysToList(&targets, &targetList);
+ */
+void iSYS4001::targetArraysToList(const iSYSTargetArrays_t *pTargetArrays, iSYSTargetList_t *pTargetList)
+{
+    pTargetList->error = pTargetArrays->error;
+    pTargetList->outputNumber = pTargetArrays->outputNumber;
+    pTargetList->nrOfTargets = pTargetArrays->nrOfTargets;
+    pTargetList->clippingFlag = pTargetArrays->clippingFlag;
 
-    uint8_t fcs = calculateFCS(command, 4, 10);
+    // The source only guarantees its valid entries (see setTargetListZeroFill())
+    for (uint8_t i = 0; i < MAX_TARGETS; i++)
+    {
+        const bool listed = (i < pTargetArrays->nrOfTargets);
+        pTargetList->targets[i].signal = listed ? pTargetArrays->signal[i] : 0.0f;
+        pTargetList->targets[i].velocity = listed ? pTargetArrays->velocity[i] : 0.0f;
+        pTargetList->targets[i].range = listed ? pTargetArrays->range[i] : 0.0f;
+        pTargetList->targets[i].angle = listed ? pTargetArrays->angle[i] : 0.0f;
+    }
+}
 
-    command[11] = fcs;
-    command[12] = 0x16;
+/**
+ * @brief Decode a complete target list frame into integer fixed-point units
+ *
+ * Same as decodeTargetList(const uint8_t *, uint16_t, iSYSTargetList_t *) with an
+ * iSYSTargetListFixed_t as destination.
+ *
+ * @param frame Complete frame from the start delimiter to the end delimiter 0x16
+ * @param length Number of bytes in the frame
+ * @param pTargetList Pointer to iSYSTargetListFixed_t structure to populate with decoded data
+ *
+ * @return iSYSResult_t ERR_OK on success, or the error codes of decodeTargetList()
+ */
+iSYSResult_t iSYS4001::decodeTargetList(const uint8_t *frame, uint16_t length, iSYSTargetListFixed_t *pTargetList)
+{
+    if (frame == nullptr || pTargetList == nullptr)
+    {
+        return ERR_NULL_POINTER;
+    }
 
-    debugPrintHexFrame("Sending SET signal min command to radar: ", command, 13);
+    clearTargetList(pTargetList, _zeroFill);
+    const bool checksumValid = (length >= 2) && (iSYSFrameParser::checksum(frame, length) == frame[length - 2]);
+    return checkAndDecodeTargetList(frame, length, targetListBitrate(frame, length), checksumValid, pTargetList);
+}
 
-    size_t bytesWritten = _serial.write(command, 13);
-    _serial.flush();
+/**
+ * @brief Convert a fixed-point target list into the float iSYSTargetList_t layout
+ *
+ * @param pFixedList Source list
+ * @param pTargetList Destination list; targets past nrOfTargets are cleared
+ *
+ * @note Uses the iSYSTarget*() accessors. For 32-bit lists the result is identical to
+ *       decoding the frame into an iSYSTargetList_t; for 16-bit lists range and velocity
+ *       may differ from it in the last bit of the float.
+ */
+void iSYS4001::targetListFixedToList(const iSYSTargetListFixed_t *pFixedList, iSYSTargetList_t *pTargetList)
+{
+    pTargetList->error = pFixedList->error;
+    pTargetList->outputNumber = pFixedList->outputNumber;
+    pTargetList->nrOfTargets = pFixedList->nrOfTargets;
+    pTargetList->clippingFlag = pFixedList->clippingFlag;
 
-    if (bytesWritten != 13)
+    for (uint8_t i = 0; i < MAX_TARGETS; i++)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        const bool listed = (i < pFixedList->nrOfTargets);
+        pTargetList->targets[i].signal = listed ? iSYSTargetSignal(&pFixedList->targets[i]) : 0.0f;
+        pTargetList->targets[i].velocity = listed ? iSYSTargetVelocity(&pFixedList->targets[i]) : 0.0f;
+        pTargetList->targets[i].range = listed ? iSYSTargetRange(&pFixedList->targets[i]) : 0.0f;
+        pTargetList->targets[i].angle = listed ? iSYSTargetAngle(&pFixedList->targets[i]) : 0.0f;
     }
+}
 
-    uint8_t response[9];
-    size_t minIndex = 0;
-    uint32_t startTime = millis();
+/**
+ * @brief Copy a target list from the iSYSTargetList_t layout into one array per field
+ *
+ * @param pTargetList Source list
+ * @param pTargetArrays Destination list; entries past nrOfTargets and the padding are cleared
+ */
+void iSYS4001::targetListToArrays(const iSYSTargetList_t *pTargetList, iSYSTargetArrays_t *pTargetArrays)
+{
+    pTargetArrays->error = pTargetList->error;
+    pTargetArrays->outputNumber = pTargetList->outputNumber;
+    pTargetArrays->nrOfTargets = pTargetList->nrOfTargets;
+    pTargetArrays->clippingFlag = pTargetList->clippingFlag;
 
-    while ((millis() - startTime) < timeout && minIndex < sizeof(response))
+    for (uint8_t i = 0; i < ISYS_TARGET_ARRAY_CAPACITY; i++)
     {
-        if (_serial.available())
-        {
-            response[minIndex++] = _serial.read();
-
-            if (response[minIndex - 1] == 0x16)
-                break;
-        }
+        const bool listed = (i < pTargetList->nrOfTargets) && (i < MAX_TARGETS);
+        pTargetArrays->signal[i] = listed ? pTargetList->targets[i].signal : 0.0f;
+        pTargetArrays->velocity[i] = listed ? pTargetList->targets[i].velocity : 0.0f;
+        pTargetArrays->range[i] = listed ? pTargetList->targets[i].range : 0.0f;
+        pTargetArrays->angle[i] = listed ? pTargetList->targets[i].angle : 0.0f;
     }
+}
 
-    debugPrintHexFrame("Received SET signal min acknowledgement: ", response, minIndex);
+/**
+ * @brief Internal function to check a target list frame against its target count and decode it
+ *
+ * @param frame Complete target list frame (SD2 or 32-bit long frame)
+ * @param length Number of bytes in the frame
+ * @param bitrate Data precision: 16 for 16-bit format, 32 for 32-bit format
+ * @param checksumValid Result of the FCS check, done by the caller so received frames are not summed twice
+ * @param pTargetList iSYSTargetList_t, iSYSTargetArrays_t or iSYSTargetListFixed_t to populate with decoded data
+ *
+ * @return iSYSResult_t ERR_OK, ERR_FRAME_INCOMPLETE, ERR_COMMAND_MAX_DATA_OVERFLOW,
+ *         ERR_INVALID_CHECKSUM or an error from decodeTargetFrame()
+ *
+ * @note Used by evaluateResponse() (FCS from the frame parser) and decodeTargetList()
+ * @note pTargetList is left untouched unless the frame passes every check, so a
+ *       corrupted frame never shows up as targets
+ */
+template <typename TargetList>
+iSYSResult_t iSYS4001::checkAndDecodeTargetList(const uint8_t *frame, uint16_t length, uint8_t bitrate, bool checksumValid, TargetList *pTargetList)
+{
+    const uint8_t headerLen = (frame[0] == ISYS_FRAME_SD2) ? 9 : 6;
+    const uint8_t bytesPerTgt = (bitrate == 32) ? 14 : 7;
 
-    if (minIndex == 0)
+    if (length < headerLen + 2)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        return ERR_FRAME_INCOMPLETE;
     }
 
-    if (minIndex < 9)
+    uint8_t nrOfTargets = frame[headerLen - 1];
+    if (nrOfTargets > MAX_TARGETS && nrOfTargets != 0xFF)
     {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
+        return ERR_COMMAND_MAX_DATA_OVERFLOW;
     }
 
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD5 || response[8] != 0x16)
+    // A clipping frame (0xFF) carries no target records
+    const uint8_t nrOfRecords = (nrOfTargets == 0xFF) ? 0 : nrOfTargets;
+    if (length != headerLen + (bytesPerTgt * nrOfRecords) + 2)
     {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
+        return ERR_FRAME_INCOMPLETE;
     }
 
-    if (minIndex >= 9)
+    if (!checksumValid)
     {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
+        return ERR_INVALID_CHECKSUM;
     }
-    return ERR_OK;
+
+    return decodeTargetFrame((uint8_t *)frame, length, bitrate, pTargetList);
 }
 
 /**
- * @brief Set the maximum signal strength threshold for a specified output channel
+ * @brief Internal function to decode target list frame data into structured format
  *
- * Configures the maximum signal strength threshold for the specified output channel
- * on the iSYS-4001 radar device. The signal value is provided in dB and is
- * automatically converted to the device's internal 0.1dB fixed-point format.
+ * Parses the raw frame data received from the radar device and extracts
+ * target information into an iSYSTargetList_t, iSYSTargetArrays_t or iSYSTargetListFixed_t;
+ * the layouts share this function through clearTargets() and decodeRecords16/32(). Only
+ * the nrOfTargets decoded entries are written unless zero fill is enabled. Handles both 16-bit
+ * and 32-bit data formats with appropriate scaling and conversion. Validates
+ * frame structure and populates target data including signal strength, velocity,
+ * range, and angle for each detected target.
  *
- * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param signal Maximum signal strength in dB (0.1 to 250.0)
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ * @param frame_array Pointer to the raw frame data received from the device
+ * @param nrOfElements Total number of bytes in the frame array
+ * @param bitrate Data precision: 16 for 16-bit format, 32 for 32-bit format
+ * @param targetList iSYSTargetList_t, iSYSTargetArrays_t or iSYSTargetListFixed_t to populate with decoded data
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_PARAMETER_OUT_OF_RANGE: Signal value outside valid limits
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ *         - ERR_COMMAND_NO_VALID_FRAME_FOUND: Frame structure validation failed
+ *         - ERR_COMMAND_FAILURE: Invalid number of targets in frame
  *
- * @note The function automatically converts dB to 0.1dB fixed-point format (multiply by 10)
- * @note Changes take effect immediately but should be saved with saveApplicationSettings()
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @note This function handles the complex frame parsing and data conversion
+ * @note Used internally by receiveTargetListResponse() function
+ * @note Supports both 16-bit (7 bytes per target) and 32-bit (14 bytes per target) formats
+ * @note Automatically handles clipping flag (0xFF) when device data is saturated; the list
+ *       then reports nrOfTargets = 0
  *
  * @example
- *   // Set maximum signal to 50 dB for output 1
- *   iSYSResult_t res = radar.iSYS_setOutputSignalMax(ISYS_OUTPUT_1, 50, 0x80, 300);
+ *   // Internal usage - called by receiveTargetListResponse()
+ *   uint8_t frame[100];
+ *   iSYSTargetList_t targets;
+ *   iSYSResult_t res = decodeTargetFrame(frame, 50, 32, &targets);
  *   if (res == ERR_OK) {
- *       Serial.println("Maximum signal threshold set successfully");
+ *       // targets structure now contains decoded target data
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_setOutputSignalMax(iSYSOutputNumber_t outputnumber, uint16_t signal, uint8_t destAddress, uint32_t timeout)
+template <typename TargetList>
+iSYSResult_t iSYS4001::decodeTargetFrame(uint8_t *frame_array, uint16_t nrOfElements, uint8_t bitrate, TargetList *targetList)
 {
+    uint16_t ui16_fc;
+    uint8_t output_number;
+    uint8_t nrOfTargets;
+    uint8_t *pData;
 
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
+    if (frame_array[0] == 0x68)
     {
-        return ERR_OUTPUT_OUT_OF_RANGE;
+        ui16_fc = 6;
     }
-
-    if (signal < 0.1 || signal > 250.0)
+    else
     {
-        return ERR_PARAMETER_OUT_OF_RANGE;
+        ui16_fc = 3;
     }
 
-    if (timeout == 0)
+    output_number = (uint16_t)(frame_array[ui16_fc + 1] & 0x00ff);
+    nrOfTargets = (uint16_t)(frame_array[ui16_fc + 2] & 0x00ff);
+    pData = &frame_array[ui16_fc + 3];
+
+    if (frame_array[nrOfElements - 1] != 0x16)
     {
-        return ERR_TIMEOUT;
+        return ERR_COMMAND_NO_VALID_FRAME_FOUND;
     }
 
-    uint8_t command[13];
-    uint8_t index = 0;
-    uint16_t scaledRange = signal * 10;
-    uint8_t maxHighByte = (scaledRange >> 8) & 0xFF;
-    uint8_t maxLowByte = scaledRange & 0xFF;
-
-    command[index++] = 0x68;
-    command[index++] = 0x07;
-    command[index++] = 0x07;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD5;
-    command[index++] = outputnumber;
-    command[index++] = 0x0B;
-    command[index++] = maxHighByte;
-    command[index++] = maxLowByte;
-
-    uint8_t fcs = calculateFCS(command, 4, 10);
-
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Sending SET signal max command to radar: ", command, 13);
-
-    size_t bytesWritten = _serial.write(command, 13);
-    _serial.flush();
-
-    if (bytesWritten != 13)
+    if ((nrOfTargets > MAX_TARGETS) && (nrOfTargets != 0xff))
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        return ERR_COMMAND_FAILURE;
     }
 
-    uint8_t response[9];
-    uint32_t startTime = millis();
-    size_t maxIndex = 0;
+    if (nrOfTargets != 0xff)
+    { // 0xff  clipping
+        targetList->nrOfTargets = nrOfTargets;
+        targetList->clippingFlag = 0;
+        targetList->outputNumber = output_number;
 
-    while ((millis() - startTime) < timeout && maxIndex < 9)
-    {
-        if (_serial.available())
+        // Record layouts and scaling: see iSYSTargetDecoder.h
+        if (bitrate == 32)
         {
-            response[maxIndex++] = _serial.read();
-            if (response[maxIndex - 1] == 0x16)
-                break;
+            decodeRecords32(targetList, pData, nrOfTargets);
         }
-    }
 
-    debugPrintHexFrame("Received SET signal max acknowledgement: ", response, maxIndex);
+        if (bitrate == 16)
+        {
+            decodeRecords16(targetList, pData, nrOfTargets);
+        }
 
-    if (maxIndex == 0)
+        clearTargets(targetList, nrOfTargets, _zeroFill);
+    }
+    else
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        // A clipping frame carries no targets; a stream must not keep the previous cycle's
+        targetList->nrOfTargets = 0;
+        targetList->clippingFlag = 1;
+        targetList->outputNumber = output_number;
+        clearTargets(targetList, 0, _zeroFill);
     }
-
-    if (maxIndex < 9)
+    if (nrOfTargets == MAX_TARGETS)
     {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
+        targetList->error.iSYSTargetListError = TARGET_LIST_FULL;
+    }
+    else
+    {
+        targetList->error.iSYSTargetListError = TARGET_LIST_OK;
     }
+    return ERR_OK;
+}
+
+/***************************************************************
+ *  PARAMETER COMMAND ENGINE
+ ***************************************************************/
+
+/*
+ * Descriptor of every parameter reachable through 0xD2-0xD5, in iSYSParameter_t order.
+ * The public getters and setters only select a row; frame layout, validation, scaling
+ * and response handling are shared by setParameter() and getParameter().
+ */
+const iSYS4001::iSYSParameterDescriptor_t iSYS4001::_parameters[ISYS_PARAMETER_COUNT] = {
+    {0x08, ISYS_PARAMETER_PER_OUTPUT, ISYS_SCALING_TENTHS, ISYS_RESPONSE_RANGE, 0, 149},                                           // range min, m
+    {0x09, ISYS_PARAMETER_PER_OUTPUT, ISYS_SCALING_TENTHS, ISYS_RESPONSE_RANGE, 1, 150},                                           // range max, m
+    {0x0C, ISYS_PARAMETER_PER_OUTPUT, ISYS_SCALING_KMH_TO_TENTHS, ISYS_RESPONSE_VELOCITY, 0, 249},                                 // velocity min, km/h
+    {0x0D, ISYS_PARAMETER_PER_OUTPUT, ISYS_SCALING_KMH_TO_TENTHS, ISYS_RESPONSE_VELOCITY, 1, 250},                                 // velocity max, km/h
+    {0x0A, ISYS_PARAMETER_PER_OUTPUT, ISYS_SCALING_TENTHS, ISYS_RESPONSE_SIGNAL, 0, 249},                                          // signal min, dB
+    {0x0B, ISYS_PARAMETER_PER_OUTPUT, ISYS_SCALING_TENTHS, ISYS_RESPONSE_SIGNAL, 1, 250},                                          // signal max, dB
+    {0x0E, ISYS_PARAMETER_PER_OUTPUT, ISYS_SCALING_RAW, ISYS_RESPONSE_DIRECTION, 0, 0xFF},                                         // iSYSDirection_type_t
+    {0x15, ISYS_PARAMETER_PER_OUTPUT, ISYS_SCALING_RAW, ISYS_RESPONSE_FILTER_TYPE, 0, 0xFF},                                       // iSYSOutput_filter_t
+    {0x16, ISYS_PARAMETER_PER_OUTPUT, ISYS_SCALING_RAW, ISYS_RESPONSE_SIGNAL_FILTER, 0, 0xFF},                                     // iSYSFilter_signal_t
+    {0x10, 0, ISYS_SCALING_RAW, ISYS_RESPONSE_RANGE_BOUND, 0, 1},                                                                  // 0 = 0-50 m, 1 = 0-150 m
+    {0x01, ISYS_PARAMETER_GET_BROADCAST | ISYS_PARAMETER_ACK_FROM_VALUE, ISYS_SCALING_RAW, ISYS_RESPONSE_DEVICE_ADDRESS, 0, 0xFF}  // device address
+};
+
+/**
+ * @brief Internal function to check a parameter value and convert it to the device's format
+ *
+ * @param parameter Parameter the value is for
+ * @param value Value in the unit of the public setter (m, km/h, dB or the enum value)
+ * @param rawValue Receives the 16-bit value sent on the wire
+ *
+ * @return iSYSResult_t ERR_OK, or ERR_PARAMETER_OUT_OF_RANGE if value is outside the descriptor's limits
+ */
+iSYSResult_t iSYS4001::encodeParameter(iSYSParameter_t parameter, uint16_t value, uint16_t *rawValue)
+{
+    const iSYSParameterDescriptor_t *descriptor = &_parameters[parameter];
 
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD5 || response[8] != 0x16)
+    if (value < descriptor->minValue || value > descriptor->maxValue)
     {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
+        return ERR_PARAMETER_OUT_OF_RANGE;
     }
 
-    if (maxIndex >= 9)
+    *rawValue = value;
+    if (descriptor->scaling == ISYS_SCALING_TENTHS)
     {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
+        *rawValue = value * 10;
+    }
+    else if (descriptor->scaling == ISYS_SCALING_KMH_TO_TENTHS)
+    {
+        *rawValue = (uint16_t)round((value / 3.6f) * 10.0f);
     }
 
     return ERR_OK;
 }
 
 /**
- * @brief Get the current minimum signal strength threshold for a specified output channel
- *
- * Retrieves the current minimum signal strength threshold for the specified output channel
- * from the iSYS-4001 radar device. The signal value is returned in dB after automatic
- * conversion from the device's internal 0.1dB fixed-point format.
+ * @brief Internal function to write one parameter and wait for the acknowledgement
  *
- * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param signal Pointer to float variable that will receive the minimum signal strength in dB
+ * Validates the output number and value against the parameter's descriptor, converts
+ * the value to the device's fixed-point format and sends the 0xD3/0xD5 request.
+ *
+ * @param parameter Parameter to write
+ * @param outputnumber Output channel for per-output parameters, ignored otherwise
+ * @param value Value in the unit of the public setter (m, km/h, dB or the enum value)
  * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for response
+ * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_NULL_POINTER: signal pointer is null
  *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_PARAMETER_OUT_OF_RANGE: Value outside the descriptor's limits
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ *         - any error of sendFrame() and awaitResponse()
  *
- * @note The function automatically converts from 0.1dB fixed-point format to dB (divide by 10)
- * @note Recommended timeout is >= 100ms (300ms used in examples)
- *
- * @example
- *   // Get current minimum signal for output 1
- *   float minSignal = 0;
- *   iSYSResult_t res = radar.iSYS_getOutputSignalMin(ISYS_OUTPUT_1, &minSignal, 0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.print("Current minimum signal: ");
- *       Serial.print(minSignal);
- *       Serial.println(" dB");
- *   }
+ * @note Used by every public parameter setter
+ * @note With a parameter cache set, a value the device already holds is not sent again
+ *       and ERR_OK is returned at once (see setParameterCache()).
  */
-iSYSResult_t iSYS4001::iSYS_getOutputSignalMin(iSYSOutputNumber_t outputnumber, float *signal, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::setParameter(iSYSParameter_t parameter, uint8_t outputnumber, uint16_t value, uint8_t destAddress, uint32_t timeout)
 {
+    const iSYSParameterDescriptor_t *descriptor = &_parameters[parameter];
+    const bool perOutput = (descriptor->flags & ISYS_PARAMETER_PER_OUTPUT) != 0;
 
-    if (signal == NULL)
-        return ERR_NULL_POINTER;
-
-    uint8_t command[11];
-    uint8_t index = 0;
-    command[index++] = 0x68;
-    command[index++] = 0x05;
-    command[index++] = 0x05;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD4;
-    command[index++] = outputnumber;
-    command[index++] = 0x0A;
-    uint8_t fcs = calculateFCS(command, 4, 8);
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Sending GET Signal Min command: ", command, sizeof(command));
-
-    size_t bytesWritten = _serial.write(command, sizeof(command));
-    _serial.flush();
-
-    if (bytesWritten != sizeof(command))
+    if (perOutput && (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3))
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        return ERR_OUTPUT_OUT_OF_RANGE;
     }
 
-    uint8_t response[11];
-    uint32_t startTime = millis();
-    uint8_t rIdx = 0;
-    while ((millis() - startTime) < timeout && rIdx < 11)
+    uint16_t rawValue;
+    iSYSResult_t res = encodeParameter(parameter, value, &rawValue);
+    if (res != ERR_OK)
     {
-        if (_serial.available())
-        {
-            response[rIdx++] = _serial.read();
-            if (response[rIdx - 1] == 0x16)
-                break;
-        }
+        return res;
     }
 
-    debugPrintHexFrame("Received Signal Min response: ", response, rIdx);
-
-    if (rIdx == 0)
+    if (timeout == 0)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        return ERR_TIMEOUT;
     }
 
-    if (rIdx < 11)
+    // The device already holds this value
+    const uint8_t entry = cacheEntry(parameter, outputnumber, destAddress);
+    uint16_t cached;
+    if (cachedValue(entry, &cached) && cached == rawValue)
     {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
+        return ERR_OK;
     }
 
-    if (response[0] != 0x68 || response[1] != 0x05 || response[2] != 0x05 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD4 || response[10] != 0x16)
+    const uint8_t functionCode = perOutput ? 0xD5 : 0xD3;
+    res = sendParameterRequest(functionCode, perOutput ? outputnumber : 0x00, descriptor->subFunction, &rawValue, destAddress);
+    if (res != ERR_OK)
     {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
+        return res;
     }
 
-    if (rIdx == 11)
+    // Until the acknowledgement arrives the device may hold either value
+    invalidateCachedValue(entry);
+    if (parameter == ISYS_PARAMETER_RANGE_BOUND)
     {
-        uint8_t expectedFCS = calculateFCS(response, 4, 8);
-        if (response[9] != expectedFCS)
+        // The sensor may limit the range window of every output to the new bound
+        for (uint8_t output = ISYS_OUTPUT_1; output <= ISYS_OUTPUT_3; output++)
         {
-            return ERR_INVALID_CHECKSUM;
+            invalidateCachedValue(cacheEntry(ISYS_PARAMETER_RANGE_MIN, output, destAddress));
+            invalidateCachedValue(cacheEntry(ISYS_PARAMETER_RANGE_MAX, output, destAddress));
         }
     }
+    _transaction.cacheEntry = entry;
+    _transaction.cacheValue = rawValue;
 
-    uint16_t rawSignal = ((uint16_t)response[7] << 8) | (uint16_t)response[8];
-
-    *signal = (float)rawSignal / 10.0f; // result in dB
-
-    return ERR_OK;
+    // A new device address is acknowledged by the device under that address
+    const uint8_t ackAddress = (descriptor->flags & ISYS_PARAMETER_ACK_FROM_VALUE) ? (uint8_t)value : destAddress;
+    return awaitResponse(ISYS_RESPONSE_ACK, functionCode, ackAddress, nullptr, timeout, "Received SET parameter acknowledgement: ");
 }
 
 /**
- * @brief Get the current maximum signal strength threshold for a specified output channel
+ * @brief Internal function to read one parameter
  *
- * Retrieves the current maximum signal strength threshold for the specified output channel
- * from the iSYS-4001 radar device. The signal value is returned in dB after automatic
- * conversion from the device's internal 0.1dB fixed-point format.
+ * Sends the 0xD2/0xD4 request for the parameter and decodes the response into
+ * output according to the descriptor's response layout (see evaluateResponse()).
  *
- * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param signal Pointer to float variable that will receive the maximum signal strength in dB
+ * @param parameter Parameter to read
+ * @param outputnumber Output channel for per-output parameters, ignored otherwise
+ * @param output Caller-owned destination; its type follows the public getter (float or enum)
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for response
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_NULL_POINTER: signal pointer is null
+ *         - ERR_NULL_POINTER: output is null
  *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
- *
- * @note The function automatically converts from 0.1dB fixed-point format to dB (divide by 10)
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ *         - any error of sendFrame() and awaitResponse()
  *
- * @example
- *   // Get current maximum signal for output 1
- *   float maxSignal = 0;
- *   iSYSResult_t res = radar.iSYS_getOutputSignalMax(ISYS_OUTPUT_1, &maxSignal, 0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.print("Current maximum signal: ");
- *       Serial.print(maxSignal);
- *       Serial.println(" dB");
- *   }
+ * @note Used by every public parameter getter
+ * @note With a parameter cache set, a known value is returned without a request
+ *       (see setParameterCache()).
  */
-iSYSResult_t iSYS4001::iSYS_getOutputSignalMax(iSYSOutputNumber_t outputnumber, float *signal, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::getParameter(iSYSParameter_t parameter, uint8_t outputnumber, void *output, uint8_t destAddress, uint32_t timeout)
 {
-    if (signal == NULL)
-        return ERR_NULL_POINTER;
+    const iSYSParameterDescriptor_t *descriptor = &_parameters[parameter];
+    const bool perOutput = (descriptor->flags & ISYS_PARAMETER_PER_OUTPUT) != 0;
 
-    uint8_t command[11];
-    uint8_t index = 0;
-    command[index++] = 0x68;
-    command[index++] = 0x05;
-    command[index++] = 0x05;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD4;
-    command[index++] = outputnumber;
-    command[index++] = 0x0B;
-    uint8_t fcs = calculateFCS(command, 4, 8);
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Sending GET Signal Max command: ", command, sizeof(command));
-
-    size_t bytesWritten = _serial.write(command, sizeof(command));
-    _serial.flush();
-
-    if (bytesWritten != sizeof(command))
+    if (output == nullptr)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        return ERR_NULL_POINTER;
     }
 
-    uint8_t response[11];
-    uint32_t startTime = millis();
-    uint8_t rIdx = 0;
-    while ((millis() - startTime) < timeout && rIdx < 11)
+    if (perOutput && (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3))
     {
-        if (_serial.available())
-        {
-            response[rIdx++] = _serial.read();
-            if (response[rIdx - 1] == 0x16)
-                break;
-        }
+        return ERR_OUTPUT_OUT_OF_RANGE;
     }
 
-    debugPrintHexFrame("Received Signal Max response: ", response, rIdx);
-
-    if (rIdx == 0)
+    if (timeout == 0)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        return ERR_TIMEOUT;
     }
 
-    if (rIdx < 11)
+    const uint8_t entry = cacheEntry(parameter, outputnumber, destAddress);
+    uint16_t cached;
+    if (cachedValue(entry, &cached))
     {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
+        decodeParameterValue(descriptor->response, cached, output);
+        return ERR_OK;
     }
 
-    if (response[0] != 0x68 || response[1] != 0x05 || response[2] != 0x05 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD4 || response[10] != 0x16)
+    const uint8_t functionCode = perOutput ? 0xD4 : 0xD2;
+    const uint8_t requestAddress = (descriptor->flags & ISYS_PARAMETER_GET_BROADCAST) ? 0x00 : destAddress;
+    iSYSResult_t res = sendParameterRequest(functionCode, perOutput ? outputnumber : 0x00, descriptor->subFunction, nullptr, requestAddress);
+    if (res != ERR_OK)
     {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
+        return res;
     }
 
-    if (rIdx == 11)
+    _transaction.cacheEntry = entry;
+    return awaitResponse(descriptor->response, functionCode, destAddress, output, timeout, "Received GET parameter response: ");
+}
+
+/**
+ * @brief Internal function to build and send a parameter request frame
+ *
+ * GET requests (rawValue == nullptr) are 11 bytes, SET requests carry the 16-bit
+ * value big endian and are 13 bytes:
+ *   0x68 LE LE 0x68 DA 0x01 FC selector subFunction [valueHigh valueLow] FCS 0x16
+ *
+ * @param functionCode 0xD2/0xD4 (GET) or 0xD3/0xD5 (SET)
+ * @param selector Output number for 0xD4/0xD5, 0x00 for the device-level 0xD2/0xD3
+ * @param subFunction Parameter id
+ * @param rawValue Value already in the device's format, nullptr for GET requests
+ * @param destAddress Address the frame is sent to
+ *
+ * @return iSYSResult_t ERR_OK or an error from sendFrame()
+ */
+iSYSResult_t iSYS4001::sendParameterRequest(uint8_t functionCode, uint8_t selector, uint8_t subFunction, const uint16_t *rawValue, uint8_t destAddress)
+{
+    uint8_t command[13];
+    const uint8_t length = (rawValue != nullptr) ? 13 : 11;
+    uint8_t index = 0;
+
+    command[index++] = 0x68;
+    command[index++] = length - 6;
+    command[index++] = length - 6;
+    command[index++] = 0x68;
+    command[index++] = destAddress;
+    command[index++] = 0x01;
+    command[index++] = functionCode;
+    command[index++] = selector;
+    command[index++] = subFunction;
+
+    if (rawValue != nullptr)
     {
-        uint8_t expectedFCS = calculateFCS(response, 4, 8);
-        if (response[9] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
+        command[index++] = (*rawValue >> 8) & 0xFF;
+        command[index++] = *rawValue & 0xFF;
     }
 
-    uint16_t rawSignal = ((uint16_t)response[7] << 8) | (uint16_t)response[8];
-    *signal = (float)rawSignal / 10.0f; // result in dB
+    uint8_t fcs = calculateFCS(command, 4, index - 1);
+    command[index++] = fcs;
+    command[index++] = 0x16;
+
+    debugPrintHexFrame((rawValue != nullptr) ? "Sending SET parameter command: " : "Sending GET parameter command: ", command, length);
 
-    return ERR_OK;
+    return sendFrame(command, length);
+}
+
+/**
+ * @brief Internal function to convert a parameter value from the device's format
+ *
+ * @param type Response layout of the parameter
+ * @param rawValue 16-bit value from bytes 7-8 of the response, or from the parameter cache
+ * @param output Caller-owned destination; float for range (m), velocity (km/h) and
+ *        signal (dB), the matching enum or uint8_t otherwise
+ */
+void iSYS4001::decodeParameterValue(iSYSResponseType_t type, uint16_t rawValue, void *output)
+{
+    const uint8_t lowByte = (uint8_t)(rawValue & 0xFF);
+
+    switch (type)
+    {
+    case ISYS_RESPONSE_RANGE:
+        *(float *)output = (float)rawValue / 10.0f; // return in m(meters)
+        break;
+    case ISYS_RESPONSE_VELOCITY:
+        *(float *)output = ((float)rawValue / 10.0f) * 3.6f; // return in km/h
+        break;
+    case ISYS_RESPONSE_SIGNAL:
+        *(float *)output = (float)rawValue / 10.0f; // result in dB
+        break;
+    case ISYS_RESPONSE_DIRECTION:
+        *(iSYSDirection_type_t *)output = (iSYSDirection_type_t)lowByte;
+        break;
+    case ISYS_RESPONSE_FILTER_TYPE:
+        *(iSYSOutput_filter_t *)output = (iSYSOutput_filter_t)lowByte;
+        break;
+    case ISYS_RESPONSE_SIGNAL_FILTER:
+        *(iSYSFilter_signal_t *)output = (iSYSFilter_signal_t)lowByte;
+        break;
+    case ISYS_RESPONSE_DEVICE_ADDRESS:
+        *(uint8_t *)output = lowByte;
+        break;
+    case ISYS_RESPONSE_RANGE_BOUND:
+        // Payload carries value 0x00 (near/50m) or 0x01 (far/150m)
+        *(iSYSRangeBound_t *)output = (lowByte == 0x01) ? ISYS_RANGE_0_TO_150 : ISYS_RANGE_0_TO_50;
+        break;
+    default:
+        break;
+    }
 }
 
 /***************************************************************
- *  SET VELOCITY DIRECTION FUNCTION
+ *  OUTPUT CONFIGURATION FUNCTIONS
  ***************************************************************/
+
 /**
- * @brief Set the target velocity direction filter for a specified output channel
+ * @brief Write the complete filter configuration of an output channel in one batch
  *
- * Configures which target directions(APPROACHING, RECEDING, BOTH) are considered for the specified output channel
- * on the iSYS-4001 radar device. This allows filtering targets based on their
- * movement direction relative to the radar sensor.
+ * Sends the nine 0xD5 requests for range, velocity and signal limits, direction,
+ * filter type and signal filter back to back, keeping up to ISYS_CONFIG_PIPELINE_DEPTH
+ * of them in flight, and collects the acknowledgements under a single timeout. This
+ * replaces nine round trips with one, which dominates commissioning time when many
+ * outputs and sensors are configured.
  *
  * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param direction Target direction filter (ISYS_TARGET_DIRECTION_APPROACHING, ISYS_TARGET_DIRECTION_RECEDING, or ISYS_TARGET_DIRECTION_BOTH)
+ * @param config Values to write; units and limits as for the individual setters
+ * @param results Receives the result of every field, indexed by iSYSOutputConfigField_t;
+ *        must stay valid until the transaction completes in non-blocking mode
  * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ * @param timeout Maximum time in milliseconds for all acknowledgements together
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ * @return iSYSResult_t ERR_OK if every field was acknowledged, otherwise the first failed
+ *         field's result (see results for the others):
+ *         - ERR_NULL_POINTER: config or results is null
  *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
- *
- * @note Setting direction filters which targets are reported by the device for the selected output
+ *         - ERR_TRANSACTION_BUSY: Another transaction is still pending
+ *         - ERR_PARAMETER_OUT_OF_RANGE: A field is outside its limits; it is not sent
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: Acknowledgements missing when the timeout expired
+ *         - ERR_INVALID_CHECKSUM, ERR_COMMAND_RX_FRAME_LENGTH: An acknowledgement was corrupted
+ *
+ * @note Fields are sent in iSYSOutputConfigField_t order. The acknowledgements are identical
+ *       frames, so a field counts as written only once its acknowledgement is certainly its
+ *       own. After a failed acknowledgement the fields from there on are sent again one at
+ *       a time. If an acknowledgement is still missing at the timeout, the pipelined ones
+ *       cannot be told apart: every field not confirmed by then is reported with the timeout
+ *       result and is not cached, even if the device applied it. Resend those.
+ * @note In non-blocking mode the call returns ERR_TRANSACTION_PENDING; poll() completes
+ *       the transaction once all acknowledgements have arrived or the timeout expired.
  * @note Changes take effect immediately but should be saved with saveApplicationSettings()
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @note Size the timeout for the whole batch: about 9 x 20 ms is a safe start.
+ * @note With a parameter cache set, fields the device already holds are reported as
+ *       ERR_OK without being sent (see setParameterCache()).
  *
  * @example
- *   // Set output 1 to detect both approaching and receding targets
- *   iSYSResult_t res = radar.iSYS_setOutputDirection(ISYS_OUTPUT_1, ISYS_TARGET_DIRECTION_BOTH, 0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.println("Direction filter set successfully");
+ *   iSYSOutputConfig_t config = {0, 50, 0, 100, 10, 250,
+ *                                ISYS_TARGET_DIRECTION_BOTH, ISYS_OUTPUT_FILTER_HIGHEST_SIGNAL, ISYS_OFF};
+ *   iSYSResult_t results[ISYS_CONFIG_FIELD_COUNT];
+ *   if (radar.iSYS_setOutputConfig(ISYS_OUTPUT_1, &config, results, 0x80, 300) != ERR_OK) {
+ *       for (uint8_t i = 0; i < ISYS_CONFIG_FIELD_COUNT; i++) {
+ *           if (results[i] != ERR_OK) Serial.println(i);
+ *       }
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_setOutputDirection(iSYSOutputNumber_t outputnumber, iSYSDirection_type_t direction, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_setOutputConfig(iSYSOutputNumber_t outputnumber, const iSYSOutputConfig_t *config, iSYSResult_t results[ISYS_CONFIG_FIELD_COUNT], uint8_t destAddress, uint32_t timeout)
 {
+    if (config == nullptr || results == nullptr)
+    {
+        return ERR_NULL_POINTER;
+    }
 
     if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
     {
@@ -2041,1063 +2828,1040 @@ iSYSResult_t iSYS4001::iSYS_setOutputDirection(iSYSOutputNumber_t outputnumber,
         return ERR_TIMEOUT;
     }
 
-    uint8_t command[13];
-    uint8_t index = 0;
+    if (_transaction.state == ISYS_TRANSACTION_PENDING)
+    {
+        return ERR_TRANSACTION_BUSY;
+    }
 
-    command[index++] = 0x68;
-    command[index++] = 0x07;
-    command[index++] = 0x07;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD5;
-    command[index++] = outputnumber;
-    command[index++] = 0x0E;
-    command[index++] = 0X00;
-    command[index++] = (uint8_t)direction;
+    // Fields map one to one onto the first parameter descriptors
+    const uint16_t values[ISYS_CONFIG_FIELD_COUNT] = {
+        config->rangeMin, config->rangeMax, config->velocityMin, config->velocityMax, config->signalMin,
+        config->signalMax, (uint16_t)config->direction, (uint16_t)config->filterType, (uint16_t)config->signalFilter};
 
-    uint8_t fcs = calculateFCS(command, 4, 10);
+    _batch.write = true;
+    _batch.destAddress = destAddress;
+    _batch.results = results;
+    _batch.snapshot = nullptr;
+    _batch.count = 0;
 
-    command[index++] = fcs;
-    command[index++] = 0x16;
+    for (uint8_t field = 0; field < ISYS_CONFIG_FIELD_COUNT; field++)
+    {
+        uint16_t rawValue;
+        results[field] = encodeParameter((iSYSParameter_t)field, values[field], &rawValue);
 
-    debugPrintHexFrame("Sending SET direction command to radar: ", command, 13);
+        // Fields the device already holds count as written
+        uint16_t cached;
+        if (results[field] == ERR_OK &&
+            !(cachedValue(cacheEntry((iSYSParameter_t)field, outputnumber, destAddress), &cached) && cached == rawValue))
+        {
+            _batch.entries[_batch.count] = parameterEntry((iSYSParameter_t)field, outputnumber);
+            _batch.rawValues[_batch.count++] = rawValue;
+        }
+    }
+
+    return startBatch(timeout, "Received configuration acknowledgement: ");
+}
+
+/**
+ * @brief Internal function to put the first requests of a parameter batch on the wire
+ *
+ * Sends up to ISYS_CONFIG_PIPELINE_DEPTH of the _batch.count prepared requests and
+ * arms the transaction for the first response; poll() handles the rest.
+ *
+ * @param timeout Maximum time in milliseconds for all responses together
+ * @param debugLabel Prefix used when printing received frames in debug mode
+ *
+ * @return iSYSResult_t Result of the batch in blocking mode, ERR_TRANSACTION_PENDING in
+ *         non-blocking mode, or the batch result at once if nothing could be sent
+ */
+iSYSResult_t iSYS4001::startBatch(uint32_t timeout, const char *debugLabel)
+{
+    _batch.sent = 0;
+    _batch.acked = 0;
+    _batch.depth = ISYS_CONFIG_PIPELINE_DEPTH;
+    _batch.confirmed = 0;
+    _batch.suspect = ISYS_BATCH_NO_SUSPECT;
+    _batch.discarded = _parser.discardedBytes();
+    _batch.unrelated = _linkStats.unrelatedFrames;
+    _batch.firstError = ERR_OK;
+    _batch.active = true;
 
-    size_t bytesWritten = _serial.write(command, 13);
-    _serial.flush();
+    while (_batch.sent < _batch.count && _batch.sent < _batch.depth && sendBatchRequest())
+    {
+    }
 
-    if (bytesWritten != 13)
+    if (_batch.sent == 0)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        // Nothing on the wire: every request was skipped or the first write failed
+        finishBatch(ERR_OK);
+        return _transaction.result;
     }
 
-    uint8_t response[9];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
+    iSYSResponseType_t type;
+    uint8_t functionCode;
+    void *output;
+    batchResponse(_batch.entries[0], &type, &functionCode, &output);
+    return awaitResponse(type, functionCode, _batch.destAddress, output, timeout, debugLabel);
+}
+
+/**
+ * @brief Internal function to send the next request of the parameter batch
+ *
+ * @return bool true if the request was written, false if the transport failed; the
+ *         failed request and all unsent ones then carry the error and are not sent
+ */
+bool iSYS4001::sendBatchRequest()
+{
+    uint8_t outputnumber;
+    const uint8_t entry = _batch.entries[_batch.sent];
+    const iSYSParameter_t parameter = entryParameter(entry, &outputnumber);
+    const iSYSParameterDescriptor_t *descriptor = &_parameters[parameter];
+    const bool perOutput = (descriptor->flags & ISYS_PARAMETER_PER_OUTPUT) != 0;
+
+    uint8_t functionCode;
+    batchResponse(entry, nullptr, &functionCode, nullptr);
 
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
+    // SET requests carry the value; the GET request for the device address is broadcast
+    const uint16_t *rawValue = _batch.write ? &_batch.rawValues[_batch.sent] : nullptr;
+    const uint8_t requestAddress = (!_batch.write && (descriptor->flags & ISYS_PARAMETER_GET_BROADCAST)) ? 0x00 : _batch.destAddress;
+
+    iSYSResult_t res = sendParameterRequest(functionCode, perOutput ? outputnumber : 0x00, descriptor->subFunction, rawValue, requestAddress);
+    if (res != ERR_OK)
     {
-        if (_serial.available())
+        for (uint8_t i = _batch.sent; i < _batch.count && _batch.write; i++)
         {
-            response[responseIndex++] = _serial.read();
-
-            if (response[responseIndex - 1] == 0x16)
-                break;
+            _batch.results[entryParameter(_batch.entries[i], &outputnumber)] = res;
+        }
+        if (_batch.firstError == ERR_OK)
+        {
+            _batch.firstError = res;
         }
+        _batch.count = _batch.sent;
+        return false;
+    }
+
+    if (_batch.write)
+    {
+        invalidateCachedValue(cacheEntry(parameter, outputnumber, _batch.destAddress));
     }
+    _batch.sent++;
+    return true;
+}
 
-    debugPrintHexFrame("Received SET direction acknowledgement: ", response, responseIndex);
+/**
+ * @brief Internal function to describe the response to one batch request
+ *
+ * @param entry Parameter entry of the request
+ * @param type Receives the response layout, or nullptr
+ * @param functionCode Receives the function code of request and response
+ * @param output Receives the snapshot field a GET response is decoded into, or nullptr
+ */
+void iSYS4001::batchResponse(uint8_t entry, iSYSResponseType_t *type, uint8_t *functionCode, void **output)
+{
+    uint8_t outputnumber;
+    const iSYSParameter_t parameter = entryParameter(entry, &outputnumber);
+    const iSYSParameterDescriptor_t *descriptor = &_parameters[parameter];
+    const bool perOutput = (descriptor->flags & ISYS_PARAMETER_PER_OUTPUT) != 0;
 
-    if (responseIndex == 0)
+    if (_batch.write)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        *functionCode = perOutput ? 0xD5 : 0xD3;
+    }
+    else
+    {
+        *functionCode = perOutput ? 0xD4 : 0xD2;
     }
 
-    if (responseIndex < 9)
+    if (type != nullptr)
     {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
+        *type = _batch.write ? ISYS_RESPONSE_ACK : descriptor->response;
     }
 
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD5 || response[8] != 0x16)
+    if (output == nullptr)
     {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
+        return;
     }
 
-    if (responseIndex >= 9)
+    *output = nullptr;
+    if (_batch.write)
     {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
+        return;
     }
 
-    return ERR_OK;
+    iSYSConfigurationSnapshot_t *snapshot = _batch.snapshot;
+    if (perOutput)
+    {
+        iSYSOutputSnapshot_t *out = &snapshot->outputs[outputnumber - ISYS_OUTPUT_1];
+        void *const fields[ISYS_CONFIG_FIELD_COUNT] = {
+            &out->rangeMin, &out->rangeMax, &out->velocityMin, &out->velocityMax, &out->signalMin,
+            &out->signalMax, &out->direction, &out->filterType, &out->signalFilter};
+        *output = fields[parameter];
+    }
+    else
+    {
+        *output = (parameter == ISYS_PARAMETER_RANGE_BOUND) ? (void *)&snapshot->rangeBound : (void *)&snapshot->deviceAddress;
+    }
 }
 
 /**
- * @brief Get the current target velocity direction for a specified output channel
- *
- * Retrieves the current target direction (APPROACHING, RECEDING, BOTH) setting for the specified output channel
- * from the iSYS-4001 radar device. This shows which target directions are currently
- * being considered for the selected output.
- *
- * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param direction Pointer to iSYSDirection_type_t variable that will receive the current direction
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for response
- *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_NULL_POINTER: direction pointer is null
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ * @brief Internal function to take one batch response and refill the pipeline
  *
- * @note The returned direction value indicates which targets are currently being reported
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * Responses carry no parameter id, so the n-th response is taken for the n-th open
+ * request. That only holds while every request is answered exactly once. Requests
+ * therefore go out in windows of _batch.depth, and the results of a window are
+ * recorded only once it has drained, i.e. every request in it got a response. A
+ * failed response, or bytes or frames the parser skipped before a response, may
+ * stand for a lost or merged one; the requests from that response onwards are sent
+ * again one at a time, where each response is unambiguous. A window that never
+ * drains stays unrecorded until finishBatch() fails it.
  *
- * @example
- *   // Get current direction for output 1
- *   iSYSDirection_type_t currentDirection;
- *   iSYSResult_t res = radar.iSYS_getOutputDirection(ISYS_OUTPUT_1, &currentDirection, 0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.print("Current direction : ");
- *       Serial.println(currentDirection);
- *   }
+ * @param result Evaluation of the response just received
+ *
+ * @return bool true while responses are still outstanding
  */
-iSYSResult_t iSYS4001::iSYS_getOutputDirection(iSYSOutputNumber_t outputnumber, iSYSDirection_type_t *direction, uint8_t destAddress, uint32_t timeout)
+bool iSYS4001::advanceBatch(iSYSResult_t result)
 {
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
+    const uint8_t index = _batch.acked++;
+    countResult(result);
+
+    // A resync or a skipped frame may have swallowed the response to an earlier request
+    const bool resynced = _parser.discardedBytes() != _batch.discarded || _linkStats.unrelatedFrames != _batch.unrelated;
+    _batch.discarded = _parser.discardedBytes();
+    _batch.unrelated = _linkStats.unrelatedFrames;
+
+    if (result == ERR_OK && !_batch.write)
     {
-        return ERR_OUTPUT_OUT_OF_RANGE;
+        _batch.rawValues[index] = _transaction.cacheValue;
     }
 
-    if (direction == NULL)
-        return ERR_NULL_POINTER;
-
-    if (timeout == 0)
+    if (_batch.depth == 1)
     {
-        return ERR_TIMEOUT;
+        recordBatchResult(index, result);
+        _batch.confirmed = _batch.acked;
     }
+    else
+    {
+        if ((result != ERR_OK || resynced) && _batch.suspect == ISYS_BATCH_NO_SUSPECT)
+        {
+            _batch.suspect = index;
+        }
 
-    uint8_t command[11];
-    uint8_t index = 0;
-    command[index++] = 0x68;
-    command[index++] = 0x05;
-    command[index++] = 0x05;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD4;
-    command[index++] = outputnumber;
-    command[index++] = 0x0E;
-    uint8_t fcs = calculateFCS(command, 4, 8);
-    command[index++] = fcs;
-    command[index++] = 0x16;
+        if (_batch.acked == _batch.sent)
+        {
+            // Drained: the order held at least up to the first suspect response
+            const uint8_t tied = (_batch.suspect == ISYS_BATCH_NO_SUSPECT) ? _batch.acked : _batch.suspect;
+            for (uint8_t i = _batch.confirmed; i < tied; i++)
+            {
+                recordBatchResult(i, ERR_OK);
+            }
+            _batch.confirmed = tied;
 
-    debugPrintHexFrame("Sending GET Direction command: ", command, sizeof(command));
+            if (_batch.suspect != ISYS_BATCH_NO_SUSPECT)
+            {
+                _batch.sent = _batch.suspect;
+                _batch.acked = _batch.suspect;
+                _batch.depth = 1;
+                _batch.suspect = ISYS_BATCH_NO_SUSPECT;
+            }
+        }
+    }
 
-    size_t bytesWritten = _serial.write(command, sizeof(command));
-    _serial.flush();
+    // The next window goes out once every response of this one is in and tied
+    while (_batch.acked == _batch.confirmed && _batch.sent < _batch.count &&
+           (uint8_t)(_batch.sent - _batch.acked) < _batch.depth)
+    {
+        // sendFrame() refuses to write while the transaction is pending
+        _transaction.state = ISYS_TRANSACTION_COMPLETE;
+        const bool sent = sendBatchRequest();
+        _transaction.state = ISYS_TRANSACTION_PENDING;
+        if (!sent)
+        {
+            break;
+        }
+    }
 
-    if (bytesWritten != sizeof(command))
+    if (_batch.acked < _batch.sent)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        // The next response answers the oldest open request
+        batchResponse(_batch.entries[_batch.acked], &_transaction.type, &_transaction.functionCode, &_transaction.output);
     }
 
-    uint8_t response[11];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
+    // Latency statistics time each response from the previous one
+    _transaction.requestMicros = _transport->micros();
+    _transaction.firstByteSeen = false;
+
+    return _batch.acked < _batch.sent;
+}
+
+/**
+ * @brief Internal function to record the result of a batch request tied to its response
+ *
+ * @param index Position of the request in _batch.entries
+ * @param result Evaluation of its response
+ *
+ * @note Only called for responses that certainly answer this request, so the parameter
+ *       cache never receives a value the device may not hold.
+ */
+void iSYS4001::recordBatchResult(uint8_t index, iSYSResult_t result)
+{
+    uint8_t outputnumber;
+    const uint8_t entry = _batch.entries[index];
+    const iSYSParameter_t parameter = entryParameter(entry, &outputnumber);
 
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
+    if (_batch.write)
     {
-        if (_serial.available())
+        _batch.results[parameter] = result;
+        if (result == ERR_OK)
         {
-            response[responseIndex++] = _serial.read();
-
-            if (response[responseIndex - 1] == 0x16)
-                break;
+            storeCachedValue(cacheEntry(parameter, outputnumber, _batch.destAddress), _batch.rawValues[index]);
         }
     }
-
-    debugPrintHexFrame("Received Direction response: ", response, responseIndex);
-
-    if (responseIndex == 0)
+    else if (result == ERR_OK)
     {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
+        _batch.snapshot->valid |= (1UL << entry);
+        storeCachedValue(cacheEntry(parameter, outputnumber, _batch.destAddress), _batch.rawValues[index]);
     }
-
-    if (responseIndex < 11)
+    else if (_batch.firstError == ERR_OK)
     {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
+        _batch.firstError = result;
     }
+}
+
+/**
+ * @brief Internal function to end the parameter batch
+ *
+ * @param pending Result for requests that were not answered (the timeout result), ERR_OK
+ *        when the batch ended normally
+ *
+ * @return iSYSTransactionState_t Always ISYS_TRANSACTION_COMPLETE
+ *
+ * @note Requests from _batch.confirmed onwards are not tied to a response: they were not
+ *       answered, or a response went missing while they were in flight. They count as
+ *       failed with the pending result, are not marked valid, and their cache entries are
+ *       invalidated.
+ */
+iSYSTransactionState_t iSYS4001::finishBatch(iSYSResult_t pending)
+{
+    iSYSResult_t result = _batch.firstError;
 
-    if (response[0] != 0x68 || response[1] != 0x05 || response[2] != 0x05 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD4 || response[7] != 0x00 || response[10] != 0x16)
+    // The device state behind a request without a tied response is unknown
+    uint8_t outputnumber;
+    for (uint8_t i = _batch.confirmed; i < _batch.count; i++)
     {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
+        const iSYSParameter_t parameter = entryParameter(_batch.entries[i], &outputnumber);
+        invalidateCachedValue(cacheEntry(parameter, outputnumber, _batch.destAddress));
+        if (_batch.write)
+        {
+            _batch.results[parameter] = pending;
+        }
     }
 
-    if (responseIndex >= 11)
+    if (_batch.write)
     {
-        uint8_t expectedFCS = calculateFCS(response, 4, 8);
-        if (response[9] != expectedFCS)
+        // First failed field in field order
+        result = ERR_OK;
+        for (uint8_t field = 0; field < ISYS_CONFIG_FIELD_COUNT && result == ERR_OK; field++)
         {
-            return ERR_INVALID_CHECKSUM;
+            result = _batch.results[field];
         }
     }
+    else if (result == ERR_OK && _batch.confirmed < _batch.count)
+    {
+        result = pending;
+    }
 
-    *direction = (iSYSDirection_type_t)response[8];
-    return ERR_OK;
+    _batch.active = false;
+    _transaction.result = result;
+    _transaction.state = ISYS_TRANSACTION_COMPLETE;
+    return ISYS_TRANSACTION_COMPLETE;
 }
 
 /***************************************************************
- *  EEPROM COMMAND FUNCTIONS
+ *  CONFIGURATION SNAPSHOT FUNCTIONS
  ***************************************************************/
 
 /**
- * @brief Internal function to send EEPROM command and wait for acknowledgement
+ * @brief Read every readable parameter of the sensor in one pipelined burst
  *
- * Sends an EEPROM command to the iSYS-4001 radar device and waits for acknowledgement.
- * This is an internal helper function used by the public EEPROM convenience functions
- * (setFactorySettings, saveSensorSettings, saveApplicationSettings, saveAllSettings).
+ * Reads range, velocity and signal limits, direction, filter type and signal filter of
+ * all three outputs, then the range bound and the device address: 29 GET requests, of
+ * which up to ISYS_CONFIG_PIPELINE_DEPTH are in flight at once, under a single timeout.
+ * This takes a fraction of the time of 29 sequential getter calls, each of which waits
+ * a full round trip before the next request goes out.
  *
- * @param subFunction EEPROM sub-function to execute (ISYS_EEPROM_SET_FACTORY_SETTINGS, ISYS_EEPROM_SAVE_SENSOR_SETTINGS, etc.)
+ * @param snapshot Receives the values; snapshot->valid has a bit set for every value that
+ *        was read (see ISYS_SNAPSHOT_OUTPUT_BIT). Must stay valid until the transaction
+ *        completes in non-blocking mode.
  * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ * @param timeout Maximum time in milliseconds for all responses together
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ * @return iSYSResult_t ERR_OK if every value was read, otherwise the first error:
+ *         - ERR_NULL_POINTER: snapshot is null
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
- *
- * @note This function performs a two-step process: send command frame, then validate acknowledgement
- * @note Used internally by public EEPROM convenience functions
- * @note EEPROM writes take effect immediately after acknowledgement
+ *         - ERR_TRANSACTION_BUSY: Another transaction is still pending
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: Responses missing when the timeout expired
+ *         - ERR_INVALID_CHECKSUM, ERR_COMMAND_RX_FRAME_LENGTH, ERR_COMMAND_RX_FRAME_DAMAGED:
+ *           A response was corrupted; the other values are still read
+ *
+ * @note Responses carry no parameter id. A value is marked valid and cached only when
+ *       its response is certainly its own: after a failed response or a parser resync
+ *       the requests from there on are read again one at a time, and values still in
+ *       doubt when the timeout expires stay invalid. Fields without a valid bit are
+ *       undefined.
+ * @note The device address is read with the broadcast request of iSYS_getDeviceAddress();
+ *       with several sensors on the bus, every one of them answers it.
+ * @note Always reads from the device. With a parameter cache set for destAddress, the
+ *       values read refresh the cache.
+ * @note In non-blocking mode the call returns ERR_TRANSACTION_PENDING; poll() completes
+ *       the transaction once all responses have arrived or the timeout expired.
+ * @note Size the timeout for the whole burst: about 29 x 20 ms is a safe start.
  *
  * @example
- *   // Internal usage - called by saveApplicationSettings()
- *   iSYSResult_t res = sendEEPROMCommand(ISYS_EEPROM_SAVE_APPLICATION_SETTINGS, 0x80, 300);
- *   if (res != ERR_OK) {
- *       // Handle EEPROM command failure
+ *   iSYSConfigurationSnapshot_t snapshot;
+ *   if (radar.readConfiguration(&snapshot, 0x80, 600) == ERR_OK) {
+ *       Serial.println(snapshot.outputs[0].rangeMax);
  *   }
  */
-iSYSResult_t iSYS4001::sendEEPROMCommand(iSYSEEPROMSubFunction_t subFunction, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::readConfiguration(iSYSConfigurationSnapshot_t *snapshot, uint8_t destAddress, uint32_t timeout)
 {
+    if (snapshot == nullptr)
+    {
+        return ERR_NULL_POINTER;
+    }
+
     if (timeout == 0)
     {
         return ERR_TIMEOUT;
     }
 
-    iSYSResult_t res = sendEEPROMCommandFrame(subFunction, destAddress);
-    if (res != ERR_OK)
+    if (_transaction.state == ISYS_TRANSACTION_PENDING)
     {
-        return res;
+        return ERR_TRANSACTION_BUSY;
     }
 
-    res = receiveEEPROMAcknowledgement(destAddress, timeout);
-    if (res != ERR_OK)
+    memset(snapshot, 0, sizeof(*snapshot));
+
+    _batch.write = false;
+    _batch.destAddress = destAddress;
+    _batch.results = nullptr;
+    _batch.snapshot = snapshot;
+    _batch.count = 0;
+
+    // Output by output, then the device-level parameters; the broadcast address request last
+    for (uint8_t output = ISYS_OUTPUT_1; output <= ISYS_OUTPUT_3; output++)
     {
-        return res;
+        for (uint8_t field = 0; field < ISYS_CONFIG_FIELD_COUNT; field++)
+        {
+            _batch.entries[_batch.count++] = parameterEntry((iSYSParameter_t)field, output);
+        }
     }
+    _batch.entries[_batch.count++] = parameterEntry(ISYS_PARAMETER_RANGE_BOUND, 0);
+    _batch.entries[_batch.count++] = parameterEntry(ISYS_PARAMETER_DEVICE_ADDRESS, 0);
 
-    return ERR_OK;
+    return startBatch(timeout, "Received configuration snapshot response: ");
 }
 
+/***************************************************************
+ *  SET/GET RANGE MIN/MAX FUNCTIONS
+ ***************************************************************/
+
 /**
- * @brief Convenience function to restore factory default settings
+ * @brief Set the minimum detection range for a specified output channel
  *
- * Restores the iSYS-4001 radar device to its factory default configuration.
- * This will reset all sensor and application parameters to their original values.
+ * Configures the minimum detection range threshold for the specified output channel
+ * on the iSYS-4001 radar device. The range value is provided in meters and is
+ * automatically converted to the device's internal 0.1m fixed-point format.
  *
+ * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param range Minimum range in meters (0 to 149.9)
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_PARAMETER_OUT_OF_RANGE: Range value outside valid limits
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function permanently changes device configuration - use with care
+ * @note The function automatically converts meters to 0.1m fixed-point format (multiply by 10)
+ * @note Integer inputs are recommended; floating-point values should be avoided to ensure consistent processing.
+ * @note Changes take effect immediately but should be saved with saveApplicationSettings()
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Restore factory settings
- *   iSYSResult_t res = radar.setFactorySettings(0x80, 300);
+ *   // Set minimum range to 5 meters for output 1
+ *   iSYSResult_t res = radar.iSYS_setOutputRangeMin(ISYS_OUTPUT_1, 5, 0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.println("Factory settings restored");
+ *       Serial.println("Minimum range set successfully");
  *   }
  */
-iSYSResult_t iSYS4001::setFactorySettings(uint8_t destAddress, uint32_t timeout)
+
+iSYSResult_t iSYS4001::iSYS_setOutputRangeMin(iSYSOutputNumber_t outputnumber, uint16_t range, uint8_t destAddress, uint32_t timeout)
 {
-    return sendEEPROMCommand(ISYS_EEPROM_SET_FACTORY_SETTINGS, destAddress, timeout);
+    return setParameter(ISYS_PARAMETER_RANGE_MIN, outputnumber, range, destAddress, timeout);
 }
 
 /**
- * @brief Convenience function to save sensor settings to EEPROM
+ * @brief Set the maximum detection range for a specified output channel
  *
- * Persists the current sensor-side parameters to the device's EEPROM memory.
- * This ensures that sensor settings survive power cycles and device resets.
+ * Configures the maximum detection range threshold for the specified output channel
+ * on the iSYS-4001 radar device. The range value is provided in meters and is
+ * automatically converted to the device's internal 0.1m fixed-point format.
  *
+ * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param range Maximum range in meters (0.1 to 150.0)
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_PARAMETER_OUT_OF_RANGE: Range value outside valid limits
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function saves sensor-specific parameters to EEPROM
+ * @note The function automatically converts meters to 0.1m fixed-point format (multiply by 10)
+ * @note Integer inputs are recommended; floating-point values should be avoided to ensure consistent processing.
+ * @note Changes take effect immediately but should be saved with saveApplicationSettings()
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Save sensor settings
- *   iSYSResult_t res = radar.saveSensorSettings(0x80, 300);
+ *   // Set maximum range to 100 meters for output 1
+ *   iSYSResult_t res = radar.iSYS_setOutputRangeMax(ISYS_OUTPUT_1, 100, 0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.println("Sensor settings saved");
+ *       Serial.println("Maximum range set successfully");
  *   }
  */
-iSYSResult_t iSYS4001::saveSensorSettings(uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_setOutputRangeMax(iSYSOutputNumber_t outputnumber, uint16_t range, uint8_t destAddress, uint32_t timeout)
 {
-    return sendEEPROMCommand(ISYS_EEPROM_SAVE_SENSOR_SETTINGS, destAddress, timeout);
+    return setParameter(ISYS_PARAMETER_RANGE_MAX, outputnumber, range, destAddress, timeout);
 }
 
 /**
- * @brief Convenience function to save application settings to EEPROM
+ * @brief Get the current minimum detection range for a specified output channel
  *
- * Persists the current application-side parameters to the device's EEPROM memory.
- * This includes range, velocity, signal, and direction settings for all outputs.
+ * Retrieves the current minimum detection range threshold for the specified output channel
+ * from the iSYS-4001 radar device. The range value is returned in meters after automatic
+ * conversion from the device's internal 0.1m fixed-point format.
  *
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param range Pointer to float variable that will receive the minimum range in meters
  * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ * @param timeout Maximum time in milliseconds to wait for response
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_NULL_POINTER: range pointer is null
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function saves application-specific parameters to EEPROM
+ * @note The function automatically converts from 0.1m fixed-point format to meters (divide by 10)
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Save application settings
- *   iSYSResult_t res = radar.saveApplicationSettings(0x80, 300);
+ *   // Get current minimum range for output 1
+ *   float minRange = 0;
+ *   iSYSResult_t res = radar.iSYS_getOutputRangeMin(ISYS_OUTPUT_1, &minRange, 0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.println("Application settings saved");
+ *       Serial.print("Current minimum range: ");
+ *       Serial.print(minRange);
+ *       Serial.println(" meters");
  *   }
  */
-iSYSResult_t iSYS4001::saveApplicationSettings(uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_getOutputRangeMin(iSYSOutputNumber_t outputnumber, float *range, uint8_t destAddress, uint32_t timeout)
 {
-    return sendEEPROMCommand(ISYS_EEPROM_SAVE_APPLICATION_SETTINGS, destAddress, timeout);
+    return getParameter(ISYS_PARAMETER_RANGE_MIN, outputnumber, range, destAddress, timeout);
 }
 
 /**
- * @brief Convenience function to save all settings to EEPROM
+ * @brief Get the current maximum detection range for a specified output channel
  *
- * Persists both sensor and application parameters to the device's EEPROM memory.
- * This is equivalent to calling both saveSensorSettings() and saveApplicationSettings().
+ * Retrieves the current maximum detection range threshold for the specified output channel
+ * from the iSYS-4001 radar device. The range value is returned in meters after automatic
+ * conversion from the device's internal 0.1m fixed-point format.
  *
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param range Pointer to float variable that will receive the maximum range in meters
  * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ * @param timeout Maximum time in milliseconds to wait for response
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_NULL_POINTER: range pointer is null
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function saves both sensor and application parameters to EEPROM
+ * @note The function automatically converts from 0.1m fixed-point format to meters (divide by 10)
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Save all settings
- *   iSYSResult_t res = radar.saveAllSettings(0x80, 300);
+ *   // Get current maximum range for output 1
+ *   float maxRange = 0;
+ *   iSYSResult_t res = radar.iSYS_getOutputRangeMax(ISYS_OUTPUT_1, &maxRange, 0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.println("All settings saved");
+ *       Serial.print("Current maximum range: ");
+ *       Serial.print(maxRange);
+ *       Serial.println(" meters");
  *   }
  */
-iSYSResult_t iSYS4001::saveAllSettings(uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_getOutputRangeMax(iSYSOutputNumber_t outputnumber, float *range, uint8_t destAddress, uint32_t timeout)
 {
-    return sendEEPROMCommand(ISYS_EEPROM_SAVE_ALL_SETTINGS, destAddress, timeout);
+    return getParameter(ISYS_PARAMETER_RANGE_MAX, outputnumber, range, destAddress, timeout);
 }
 
+/***************************************************************
+ *  SET/GET VELOCITY MIN/MAX FUNCTIONS
+ ***************************************************************/
+
 /**
- * @brief Internal function to send EEPROM command frame to radar device
+ * @brief Set the minimum velocity threshold for a specified output channel
  *
- * Constructs and transmits a command frame for EEPROM operations to the
- * iSYS-4001 radar device. This is an internal helper function used by
- * sendEEPROMCommand() to send the actual command frame.
+ * Configures the minimum velocity threshold for the specified output channel
+ * on the iSYS-4001 radar device. The velocity value is provided in km/h and is
+ * automatically converted to the device's internal m/s format with 0.1m/s precision.
  *
- * @param subFunction EEPROM sub-function to execute (ISYS_EEPROM_SET_FACTORY_SETTINGS, ISYS_EEPROM_SAVE_SENSOR_SETTINGS, etc.)
+ * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param velocity Minimum velocity in km/h (0 to 249.9)
  * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
- * @return iSYSResult_t ERR_OK on success, or error code if command transmission fails
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_PARAMETER_OUT_OF_RANGE: Velocity value outside valid limits
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function only sends the command - it does not wait for or process the response
- * @note Used internally by sendEEPROMCommand() function
- * @note The command frame includes proper framing, address, and checksum validation
+ * @note The function automatically converts km/h to m/s: scaled = round((kmh / 3.6) * 10)
+ * @note Changes take effect immediately but should be saved with saveApplicationSettings()
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Internal usage - called by sendEEPROMCommand()
- *   iSYSResult_t res = sendEEPROMCommandFrame(ISYS_EEPROM_SAVE_APPLICATION_SETTINGS, 0x80);
- *   if (res != ERR_OK) {
- *       // Handle command transmission error
+ *   // Set minimum velocity to 5 km/h for output 1
+ *   iSYSResult_t res = radar.iSYS_setOutputVelocityMin(ISYS_OUTPUT_1, 5, 0x80, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.println("Minimum velocity set successfully");
  *   }
  */
-iSYSResult_t iSYS4001::sendEEPROMCommandFrame(iSYSEEPROMSubFunction_t subFunction, uint8_t destAddress)
+iSYSResult_t iSYS4001::iSYS_setOutputVelocityMin(iSYSOutputNumber_t outputnumber, uint16_t velocity, uint8_t destAddress, uint32_t timeout)
 {
-    uint8_t command[10];
-    uint8_t index = 0;
-
-    command[index++] = 0x68;
-    command[index++] = 0x04;
-    command[index++] = 0x04;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xDF;
-    command[index++] = subFunction;
-
-    uint8_t fcs = calculateFCS(command, 4, 7);
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Sending EEPROM command to radar: ", command, 10);
-
-    size_t bytesWritten = _serial.write(command, 10);
-    _serial.flush();
-
-    if (bytesWritten != 10)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    return ERR_OK;
+    return setParameter(ISYS_PARAMETER_VELOCITY_MIN, outputnumber, velocity, destAddress, timeout);
 }
+
 /**
- * @brief Internal function to receive EEPROM command acknowledgement from radar device
+ * @brief Set the maximum velocity threshold for a specified output channel
  *
- * Waits for and validates the acknowledgement response from the iSYS-4001 radar device
- * after sending an EEPROM command. This is an internal helper function used by
- * sendEEPROMCommand() to validate the command was received and processed.
+ * Configures the maximum velocity threshold for the specified output channel
+ * on the iSYS-4001 radar device. The velocity value is provided in km/h and is
+ * automatically converted to the device's internal m/s format with 0.1m/s precision.
  *
+ * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param velocity Maximum velocity in km/h (0.5 to 250.0)
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_PARAMETER_OUT_OF_RANGE: Velocity value outside valid limits
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
  *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
  *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
  *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function validates the acknowledgement frame structure and checksum
- * @note Used internally by sendEEPROMCommand() function
- * @note EEPROM operations take effect immediately after acknowledgement
+ * @note The function automatically converts km/h to m/s: scaled = round((kmh / 3.6) * 10)
+ * @note Changes take effect immediately but should be saved with saveApplicationSettings()
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Internal usage - called by sendEEPROMCommand()
- *   iSYSResult_t res = receiveEEPROMAcknowledgement(0x80, 300);
- *   if (res != ERR_OK) {
- *       // Handle acknowledgement error
+ *   // Set maximum velocity to 120 km/h for output 1
+ *   iSYSResult_t res = radar.iSYS_setOutputVelocityMax(ISYS_OUTPUT_1, 120, 0x80, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.println("Maximum velocity set successfully");
  *   }
  */
-iSYSResult_t iSYS4001::receiveEEPROMAcknowledgement(uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_setOutputVelocityMax(iSYSOutputNumber_t outputnumber, uint16_t velocity, uint8_t destAddress, uint32_t timeout)
 {
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    uint8_t response[9];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
-
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
-    {
-        if (_serial.available())
-        {
-            response[responseIndex++] = _serial.read();
-
-            if (response[responseIndex - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received EEPROM acknowledgement: ", response, responseIndex);
-
-    if (responseIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    if (responseIndex < 9)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
-
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xDF || response[8] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
-
-    if (responseIndex >= 9)
-    {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
-    }
-
-    return ERR_OK;
+    return setParameter(ISYS_PARAMETER_VELOCITY_MAX, outputnumber, velocity, destAddress, timeout);
 }
 
-/***************************************************************
- *  CALCULATE CHECKSUM FUNCTION
- ***************************************************************/
 /**
- * @brief Calculate frame checksum (FCS) for radar communication
+ * @brief Get the current minimum velocity threshold for a specified output channel
  *
- * Computes an additive checksum across a specified range of bytes in a frame.
- * The checksum is used by the iSYS-4001 radar device to validate the integrity
- * of transmitted and received command/response frames.
+ * Retrieves the current minimum velocity threshold for the specified output channel
+ * from the iSYS-4001 radar device. The velocity value is returned in km/h after automatic
+ * conversion from the device's internal m/s format.
  *
- * @param data Pointer to byte array containing the frame data
- * @param startIndex Index of the first byte to include in the checksum
- * @param endIndex Index of the last byte to include in the checksum
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param velocity Pointer to float variable that will receive the minimum velocity in km/h
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for response
  *
- * @return uint8_t The computed checksum value
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_NULL_POINTER: velocity pointer is null
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note The checksum is calculated as the 8-bit sum of all bytes between
- *       startIndex and endIndex (inclusive).
+ * @note The function automatically converts from m/s to km/h: kmh = (raw / 10) * 3.6
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Example: calculate checksum for command frame
- *   uint8_t command[] = {0x68, 0x05, 0x05, 0x68, 0x80, 0x01, 0xD4, 0x01, 0x16};
- *   uint8_t fcs = radar.calculateFCS(command, 4, 7);
- *   Serial.print("Calculated FCS: ");
- *   Serial.println(fcs, HEX);
+ *   // Get current minimum velocity for output 1
+ *   float minVelocity = 0;
+ *   iSYSResult_t res = radar.iSYS_getOutputVelocityMin(ISYS_OUTPUT_1, &minVelocity, 0x80, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.print("Current minimum velocity: ");
+ *       Serial.print(minVelocity);
+ *       Serial.println(" km/h");
+ *   }
  */
-
-uint8_t iSYS4001::calculateFCS(const uint8_t *data, uint8_t startIndex, uint8_t endIndex)
+iSYSResult_t iSYS4001::iSYS_getOutputVelocityMin(iSYSOutputNumber_t outputnumber, float *velocity, uint8_t destAddress, uint32_t timeout)
 {
-    uint8_t fcs = 0;
-    for (uint8_t i = startIndex; i <= endIndex; i++)
-    {
-        fcs = (uint8_t)(fcs + data[i]);
-    }
-    return fcs;
+    return getParameter(ISYS_PARAMETER_VELOCITY_MIN, outputnumber, velocity, destAddress, timeout);
 }
 
-/***************************************************************
- *  DEVICE ADDRESS FUNCTIONS
- ***************************************************************/
-
 /**
- * @brief Set the device address for the radar sensor
+ * @brief Get the current maximum velocity threshold for a specified output channel
  *
- * Changes the DESTINATION address of the iSYS-4001 radar device.
- * After setting a new address, all subsequent communications must use the new address.
+ * Retrieves the current maximum velocity threshold for the specified output channel
+ * from the iSYS-4001 radar device. The velocity value is returned in km/h after automatic
+ * conversion from the device's internal m/s format.
  *
- * @param deviceaddress New device address to set (typically 0x80-0xFF)
- * @param destAddress Current known address of the device (0x00 can be used if unknown)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param velocity Pointer to float variable that will receive the maximum velocity in km/h
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for response
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_NULL_POINTER: velocity pointer is null
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
  *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
  *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
  *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note After setting a new address, subsequent communications must use the new address
- * @note Consider persisting configuration with EEPROM commands if required
+ * @note The function automatically converts from m/s to km/h: kmh = (raw / 10) * 3.6
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Set device address to 0x81, communicating to current device at 0x80
- *   iSYSResult_t res = radar.iSYS_setDeviceAddress(0x81, 0x80, 300);
+ *   // Get current maximum velocity for output 1
+ *   float maxVelocity = 0;
+ *   iSYSResult_t res = radar.iSYS_getOutputVelocityMax(ISYS_OUTPUT_1, &maxVelocity, 0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.println("Device address changed to 0x81");
- *       // Now use 0x81 for all subsequent communications
+ *       Serial.print("Current maximum velocity: ");
+ *       Serial.print(maxVelocity);
+ *       Serial.println(" km/h");
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_setDeviceAddress(uint8_t deviceaddress, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_getOutputVelocityMax(iSYSOutputNumber_t outputnumber, float *velocity, uint8_t destAddress, uint32_t timeout)
 {
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    uint8_t command[13];
-    uint8_t index = 0;
-
-    command[index++] = 0x68;
-    command[index++] = 0x07;
-    command[index++] = 0x07;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD3;
-    command[index++] = 0x00;
-    command[index++] = 0x01;
-    command[index++] = 0x00;
-    command[index++] = deviceaddress;
-
-    uint8_t fcs = calculateFCS(command, 4, 10);
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Sending SET address command: ", command, sizeof(command));
-
-    size_t bytesWritten = _serial.write(command, sizeof(command));
-    _serial.flush();
-
-    if (bytesWritten != sizeof(command))
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    uint8_t response[9];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
-
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
-    {
-        if (_serial.available())
-        {
-            response[responseIndex++] = _serial.read();
-
-            if (response[responseIndex - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received SET address acknowledgement: ", response, responseIndex);
-
-    if (responseIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    if (responseIndex < 9)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
-
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != deviceaddress ||
-        response[6] != 0xD3 || response[8] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
-
-    if (responseIndex >= 9)
-    {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
-    }
-
-    return ERR_OK;
+    return getParameter(ISYS_PARAMETER_VELOCITY_MAX, outputnumber, velocity, destAddress, timeout);
 }
 
+/***************************************************************
+ *  SET/GET SIGNAL MIN/MAX FUNCTIONS
+ ***************************************************************/
+
 /**
- * @brief Get the current device address of the radar sensor
+ * @brief Set the minimum signal strength threshold for a specified output channel
  *
- * Retrieves the current device/destination address of the iSYS-4001 radar device. This is useful
- * for discovering the address of a device when it's unknown, or for verification
- * after setting a new address.
+ * Configures the minimum signal strength threshold for the specified output channel
+ * on the iSYS-4001 radar device. The signal value is provided in dB and is
+ * automatically converted to the device's internal 0.1dB fixed-point format.
  *
- * @param deviceaddress Pointer to uint8_t variable that will receive the current device address
- * @param destAddress Current known address of the device (0x00 can be used if unknown)
- * @param timeout Maximum time in milliseconds to wait for response
+ * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param signal Minimum signal strength in dB (0.0 to 249.9)
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_NULL_POINTER: deviceaddress pointer is null
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_PARAMETER_OUT_OF_RANGE: Signal value outside valid limits
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
  *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
  *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
  *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function can be used to discover the address of an unknown device
+ * @note The function automatically converts dB to 0.1dB fixed-point format (multiply by 10)
+ * @note Changes take effect immediately but should be saved with saveApplicationSettings()
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Get current device address
- *   uint8_t currentAddress = 0;
- *   iSYSResult_t res = radar.iSYS_getDeviceAddress(&currentAddress, 0x00, 300);
+ *   // Set minimum signal to 10 dB for output 1
+ *   iSYSResult_t res = radar.iSYS_setOutputSignalMin(ISYS_OUTPUT_1, 10, 0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.print("Current device address: 0x");
- *       Serial.println(currentAddress, HEX);
+ *       Serial.println("Minimum signal threshold set successfully");
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_getDeviceAddress(uint8_t *deviceaddress, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_setOutputSignalMin(iSYSOutputNumber_t outputnumber, uint16_t signal, uint8_t destAddress, uint32_t timeout)
 {
-    if (deviceaddress == NULL)
-        return ERR_NULL_POINTER;
-
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    uint8_t command[11];
-    uint8_t index = 0;
-    command[index++] = 0x68;
-    command[index++] = 0x05;
-    command[index++] = 0x05;
-    command[index++] = 0x68;
-    command[index++] = 0x00;
-    command[index++] = 0x01;
-    command[index++] = 0xD2;
-    command[index++] = 0x00;
-    command[index++] = 0x01;
-    uint8_t fcs = calculateFCS(command, 4, 8);
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Sending GET address command: ", command, sizeof(command));
-
-    size_t bytesWritten = _serial.write(command, sizeof(command));
-    _serial.flush();
-
-    if (bytesWritten != sizeof(command))
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    uint8_t response[11];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
-
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
-    {
-        if (_serial.available())
-        {
-            response[responseIndex++] = _serial.read();
-
-            if (response[responseIndex - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received GET address response: ", response, responseIndex);
-
-    if (responseIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    if (responseIndex < 11)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
-
-    if (response[0] != 0x68 || response[1] != 0x05 || response[2] != 0x05 ||
-        response[3] != 0x68 || response[6] != 0xD2 || response[10] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
-
-    if (responseIndex >= 11)
-    {
-        uint8_t expectedFCS = calculateFCS(response, 4, 8);
-        if (response[9] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
-    }
-
-    *deviceaddress = response[8];
-    return ERR_OK;
+    return setParameter(ISYS_PARAMETER_SIGNAL_MIN, outputnumber, signal, destAddress, timeout);
 }
 
-/***************************************************************
- *  ACQUISITION CONTROL FUNCTIONS
- ***************************************************************/
-
 /**
- * @brief Start radar acquisition on the device
+ * @brief Set the maximum signal strength threshold for a specified output channel
  *
- * Initiates the measurement cycle on the iSYS-4001 radar device. This function
- * must be called before attempting to request target data or stream measurements.
- * The device will begin actively scanning and detecting targets after this command.
+ * Configures the maximum signal strength threshold for the specified output channel
+ * on the iSYS-4001 radar device. The signal value is provided in dB and is
+ * automatically converted to the device's internal 0.1dB fixed-point format.
  *
+ * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param signal Maximum signal strength in dB (0.1 to 250.0)
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_PARAMETER_OUT_OF_RANGE: Signal value outside valid limits
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
  *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
  *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
  *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
- *         - ERR_COMMAND_MAX_DATA_OVERFLOW: Response exceeds internal buffer
  *
- * @note Start acquisition before attempting to stream or repeatedly request data
+ * @note The function automatically converts dB to 0.1dB fixed-point format (multiply by 10)
+ * @note Changes take effect immediately but should be saved with saveApplicationSettings()
  * @note Recommended timeout is >= 100ms (300ms used in examples)
- * @note Flush stale UART bytes before issuing commands for improved reliability
  *
  * @example
- *   // Start radar acquisition
- *   iSYSResult_t res = radar.iSYS_startAcquisition(0x80, 300);
+ *   // Set maximum signal to 50 dB for output 1
+ *   iSYSResult_t res = radar.iSYS_setOutputSignalMax(ISYS_OUTPUT_1, 50, 0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.println("Radar acquisition started");
- *       // Now can request target data
+ *       Serial.println("Maximum signal threshold set successfully");
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_startAcquisition(uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_setOutputSignalMax(iSYSOutputNumber_t outputnumber, uint16_t signal, uint8_t destAddress, uint32_t timeout)
 {
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    iSYSResult_t res = sendAcquisitionCommand(destAddress, true);
-    if (res != ERR_OK)
-    {
-        return res;
-    }
-
-    res = receiveAcquisitionAcknowledgement(destAddress, timeout);
-    if (res != ERR_OK)
-    {
-        return res;
-    }
-
-    return ERR_OK;
+    return setParameter(ISYS_PARAMETER_SIGNAL_MAX, outputnumber, signal, destAddress, timeout);
 }
 
 /**
- * @brief Stop radar acquisition on the device
+ * @brief Get the current minimum signal strength threshold for a specified output channel
  *
- * Halts the measurement cycle on the iSYS-4001 radar device. This function
- * stops the device from actively scanning and detecting targets.
+ * Retrieves the current minimum signal strength threshold for the specified output channel
+ * from the iSYS-4001 radar device. The signal value is returned in dB after automatic
+ * conversion from the device's internal 0.1dB fixed-point format.
  *
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param signal Pointer to float variable that will receive the minimum signal strength in dB
  * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ * @param timeout Maximum time in milliseconds to wait for response
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_NULL_POINTER: signal pointer is null
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
  *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
  *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
  *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
- *         - ERR_COMMAND_MAX_DATA_OVERFLOW: Response exceeds internal buffer
  *
+ * @note The function automatically converts from 0.1dB fixed-point format to dB (divide by 10)
  * @note Recommended timeout is >= 100ms (300ms used in examples)
- * @note Flush stale  bytes before issuing commands for improved reliability
  *
  * @example
- *   // Stop radar acquisition
- *   iSYSResult_t res = radar.iSYS_stopAcquisition(0x80, 300);
+ *   // Get current minimum signal for output 1
+ *   float minSignal = 0;
+ *   iSYSResult_t res = radar.iSYS_getOutputSignalMin(ISYS_OUTPUT_1, &minSignal, 0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.println("Radar acquisition stopped");
- *       // Can now change device settings if needed
+ *       Serial.print("Current minimum signal: ");
+ *       Serial.print(minSignal);
+ *       Serial.println(" dB");
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_stopAcquisition(uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_getOutputSignalMin(iSYSOutputNumber_t outputnumber, float *signal, uint8_t destAddress, uint32_t timeout)
 {
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    iSYSResult_t res = sendAcquisitionCommand(destAddress, false);
-    if (res != ERR_OK)
-    {
-        return res;
-    }
-
-    res = receiveAcquisitionAcknowledgement(destAddress, timeout);
-    if (res != ERR_OK)
-    {
-        return res;
-    }
-
-    return ERR_OK;
+    return getParameter(ISYS_PARAMETER_SIGNAL_MIN, outputnumber, signal, destAddress, timeout);
 }
 
 /**
- * @brief Internal function to send acquisition start/stop command to radar device
+ * @brief Get the current maximum signal strength threshold for a specified output channel
  *
- * Constructs and transmits a command frame to start or stop radar acquisition
- * on the iSYS-4001 device. This is an internal helper function used by
- * iSYS_startAcquisition() and iSYS_stopAcquisition().
+ * Retrieves the current maximum signal strength threshold for the specified output channel
+ * from the iSYS-4001 radar device. The signal value is returned in dB after automatic
+ * conversion from the device's internal 0.1dB fixed-point format.
  *
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param signal Pointer to float variable that will receive the maximum signal strength in dB
  * @param destAddress Device Radar Destination address (typically 0x80)
- * @param start If true, starts acquisition; if false, stops acquisition
+ * @param timeout Maximum time in milliseconds to wait for response
  *
- * @return iSYSResult_t ERR_OK on success, or error code if command transmission fails
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_NULL_POINTER: signal pointer is null
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function only sends the command - it does not wait for or process the response
- * @note Used internally by iSYS_startAcquisition() and iSYS_stopAcquisition() functions
- * @note The command frame includes proper framing, address, and checksum validation
+ * @note The function automatically converts from 0.1dB fixed-point format to dB (divide by 10)
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Internal usage - called by iSYS_startAcquisition()
- *   iSYSResult_t res = sendAcquisitionCommand(0x80, true);
- *   if (res != ERR_OK) {
- *       // Handle error
+ *   // Get current maximum signal for output 1
+ *   float maxSignal = 0;
+ *   iSYSResult_t res = radar.iSYS_getOutputSignalMax(ISYS_OUTPUT_1, &maxSignal, 0x80, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.print("Current maximum signal: ");
+ *       Serial.print(maxSignal);
+ *       Serial.println(" dB");
  *   }
  */
-iSYSResult_t iSYS4001::sendAcquisitionCommand(uint8_t destAddress, bool start)
+iSYSResult_t iSYS4001::iSYS_getOutputSignalMax(iSYSOutputNumber_t outputnumber, float *signal, uint8_t destAddress, uint32_t timeout)
 {
-    uint8_t command[11];
-    uint8_t index = 0;
-
-    command[index++] = 0x68;
-    command[index++] = 0x05;
-    command[index++] = 0x05;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD1;
-    command[index++] = 0x00;
-    command[index++] = start ? 0x00 : 0x01;
-
-    uint8_t fcs = calculateFCS(command, 4, 8);
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    if (_debugEnabled && _debugStream)
-    {
-        _debugStream->print(start ? "Starting" : "Stopping");
-        _debugStream->print(" acquisition command to radar: ");
-    }
-    debugPrintHexFrame("", command, 11);
-
-    size_t bytesWritten = _serial.write(command, 11);
-    _serial.flush();
-
-    if (bytesWritten != 11)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
+    return getParameter(ISYS_PARAMETER_SIGNAL_MAX, outputnumber, signal, destAddress, timeout);
+}
 
-    return ERR_OK;
+/***************************************************************
+ *  SET VELOCITY DIRECTION FUNCTION
+ ***************************************************************/
+/**
+ * @brief Set the target velocity direction filter for a specified output channel
+ *
+ * Configures which target directions(APPROACHING, RECEDING, BOTH) are considered for the specified output channel
+ * on the iSYS-4001 radar device. This allows filtering targets based on their
+ * movement direction relative to the radar sensor.
+ *
+ * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param direction Target direction filter (ISYS_TARGET_DIRECTION_APPROACHING, ISYS_TARGET_DIRECTION_RECEDING, or ISYS_TARGET_DIRECTION_BOTH)
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ *
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ *
+ * @note Setting direction filters which targets are reported by the device for the selected output
+ * @note Changes take effect immediately but should be saved with saveApplicationSettings()
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
+ *
+ * @example
+ *   // Set output 1 to detect both approaching and receding targets
+ *   iSYSResult_t res = radar.iSYS_setOutputDirection(ISYS_OUTPUT_1, ISYS_TARGET_DIRECTION_BOTH, 0x80, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.println("Direction filter set successfully");
+ *   }
+ */
+iSYSResult_t iSYS4001::iSYS_setOutputDirection(iSYSOutputNumber_t outputnumber, iSYSDirection_type_t direction, uint8_t destAddress, uint32_t timeout)
+{
+    return setParameter(ISYS_PARAMETER_DIRECTION, outputnumber, (uint16_t)direction, destAddress, timeout);
 }
 
 /**
- * @brief Internal function to receive acquisition command acknowledgement from radar device
+ * @brief Get the current target velocity direction for a specified output channel
  *
- * Waits for and validates the acknowledgement response from the iSYS-4001 radar device
- * after sending an acquisition start/stop command. This is an internal helper function
- * used by iSYS_startAcquisition() and iSYS_stopAcquisition().
+ * Retrieves the current target direction (APPROACHING, RECEDING, BOTH) setting for the specified output channel
+ * from the iSYS-4001 radar device. This shows which target directions are currently
+ * being considered for the selected output.
  *
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param direction Pointer to iSYSDirection_type_t variable that will receive the current direction
  * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ * @param timeout Maximum time in milliseconds to wait for response
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_NULL_POINTER: direction pointer is null
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
  *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
  *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
  *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function validates the acknowledgement frame structure and checksum
- * @note Used internally by iSYS_startAcquisition() and iSYS_stopAcquisition() functions
+ * @note The returned direction value indicates which targets are currently being reported
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Internal usage - called by iSYS_startAcquisition()
- *   iSYSResult_t res = receiveAcquisitionAcknowledgement(0x80, 300);
- *   if (res != ERR_OK) {
- *       // Handle acknowledgement error
+ *   // Get current direction for output 1
+ *   iSYSDirection_type_t currentDirection;
+ *   iSYSResult_t res = radar.iSYS_getOutputDirection(ISYS_OUTPUT_1, &currentDirection, 0x80, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.print("Current direction : ");
+ *       Serial.println(currentDirection);
  *   }
  */
-iSYSResult_t iSYS4001::receiveAcquisitionAcknowledgement(uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_getOutputDirection(iSYSOutputNumber_t outputnumber, iSYSDirection_type_t *direction, uint8_t destAddress, uint32_t timeout)
 {
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    uint8_t response[9];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
-
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
-    {
-        if (_serial.available())
-        {
-            response[responseIndex++] = _serial.read();
-
-            if (response[responseIndex - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received acquisition acknowledgement: ", response, responseIndex);
-
-    if (responseIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    if (responseIndex < 9)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
-
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD1 || response[8] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
-
-    if (responseIndex >= 9)
-    {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
-    }
-
-    return ERR_OK;
+    return getParameter(ISYS_PARAMETER_DIRECTION, outputnumber, direction, destAddress, timeout);
 }
 
 /***************************************************************
- *  OUTPUT MULTIPLE TARGET FILTER FUNCTIONS
+ *  EEPROM COMMAND FUNCTIONS
  ***************************************************************/
 
 /**
- * @brief Set multiple target filter for a specified output channel
+ * @brief Internal function to send EEPROM command and wait for acknowledgement
  *
- * Configures the multiple target filtering for the specified output channel
- * on the iSYS-4001 radar device. This function specifically handles signal
- * selection for multiple target filtering and always sets the signal filter
- * to ISYS_OFF for multiple target operation.This is used when users want to 
- * scan multiple targets.
+ * Sends an EEPROM command to the iSYS-4001 radar device and waits for acknowledgement.
+ * This is an internal helper function used by the public EEPROM convenience functions
+ * (setFactorySettings, saveSensorSettings, saveApplicationSettings, saveAllSettings).
  *
- * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param subFunction EEPROM sub-function to execute (ISYS_EEPROM_SET_FACTORY_SETTINGS, ISYS_EEPROM_SAVE_SENSOR_SETTINGS, etc.)
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
  *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
  *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
  *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function is specifically for multiple target filtering
- * @note The signal filter is always set to ISYS_OFF for multiple target filtering
- * @note Changes take effect immediately but should be saved with saveAllSettings()
- * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @note This function performs a two-step process: send command frame, then validate acknowledgement
+ * @note Used internally by public EEPROM convenience functions
+ * @note EEPROM writes take effect immediately after acknowledgement
  *
  * @example
- *   // Set multiple target filter for output 1
- *   iSYSResult_t res = radar.iSYS_setMultipleTargetFilter(ISYS_OUTPUT_1, 0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.println("Multiple target filter set successfully");
+ *   // Internal usage - called by saveApplicationSettings()
+ *   iSYSResult_t res = sendEEPROMCommand(ISYS_EEPROM_SAVE_APPLICATION_SETTINGS, 0x80, 300);
+ *   if (res != ERR_OK) {
+ *       // Handle EEPROM command failure
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_setMultipleTargetFilter(iSYSOutputNumber_t outputnumber, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::sendEEPROMCommand(iSYSEEPROMSubFunction_t subFunction, uint8_t destAddress, uint32_t timeout)
 {
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
-    {
-        return ERR_OUTPUT_OUT_OF_RANGE;
-    }
-
     if (timeout == 0)
     {
         return ERR_TIMEOUT;
     }
 
-    iSYSResult_t res = sendSetMultipleTargetFilterRequest(outputnumber, destAddress);
+    iSYSResult_t res = sendEEPROMCommandFrame(subFunction, destAddress);
     if (res != ERR_OK)
     {
         return res;
     }
 
-    res = receiveSetMultipleTargetFilterAcknowledgement(destAddress, timeout);
+    // Factory defaults replace every parameter the cache holds for this device
+    if (subFunction == ISYS_EEPROM_SET_FACTORY_SETTINGS && _parameterCache != nullptr && _parameterCache->address == destAddress)
+    {
+        invalidateParameterCache();
+    }
+
+    res = receiveEEPROMAcknowledgement(destAddress, timeout);
     if (res != ERR_OK)
     {
         return res;
@@ -3107,271 +3871,176 @@ iSYSResult_t iSYS4001::iSYS_setMultipleTargetFilter(iSYSOutputNumber_t outputnum
 }
 
 /**
- * @brief Internal function to send multiple target filter request to radar device
+ * @brief Convenience function to restore factory default settings
  *
- * Constructs and transmits a command frame to set multiple target filtering
- * for the specified output channel on the iSYS-4001 radar device. This is an
- * internal helper function used by iSYS_setMultipleTargetFilter().
+ * Restores the iSYS-4001 radar device to its factory default configuration.
+ * This will reset all sensor and application parameters to their original values.
+ * A parameter cache for this device (see setParameterCache()) is invalidated.
  *
- * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
  * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
- * @return iSYSResult_t ERR_OK on success, or error code if command transmission fails
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions
  *
- * @note This function only sends the command - it does not wait for or process the response
- * @note Used internally by iSYS_setMultipleTargetFilter() function
- * @note The signal filter is always set to ISYS_OFF for multiple target filtering
- * @note The command frame includes proper framing, address, and checksum validation
+ * @note This function permanently changes device configuration - use with care
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Internal usage - called by iSYS_setMultipleTargetFilter()
- *   iSYSResult_t res = sendSetMultipleTargetFilterRequest(ISYS_OUTPUT_1, 0x80);
- *   if (res != ERR_OK) {
- *       // Handle command transmission error
+ *   // Restore factory settings
+ *   iSYSResult_t res = radar.setFactorySettings(0x80, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.println("Factory settings restored");
  *   }
  */
-iSYSResult_t iSYS4001::sendSetMultipleTargetFilterRequest(iSYSOutputNumber_t outputnumber, uint8_t destAddress)
+iSYSResult_t iSYS4001::setFactorySettings(uint8_t destAddress, uint32_t timeout)
 {
-    uint8_t command[13];
-    uint8_t index = 0;
-
-    command[index++] = 0x68;
-    command[index++] = 0x07;
-    command[index++] = 0x07;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD5;
-    command[index++] = outputnumber;
-    command[index++] = 0x16;
-    command[index++] = 0x00;
-    command[index++] = (uint8_t)ISYS_OFF; // Always set to ISYS_OFF
-
-    uint8_t fcs = calculateFCS(command, 4, index - 1);
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Setting multiple target filter command to radar: ", command, 13);
-
-    size_t bytesWritten = _serial.write(command, 13);
-    _serial.flush();
-
-    if (bytesWritten != 13)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    return ERR_OK;
+    return sendEEPROMCommand(ISYS_EEPROM_SET_FACTORY_SETTINGS, destAddress, timeout);
 }
 
 /**
- * @brief Internal function to receive multiple target filter acknowledgement from radar device
+ * @brief Convenience function to save sensor settings to EEPROM
  *
- * Waits for and validates the acknowledgement response from the iSYS-4001 radar device
- * after sending a multiple target filter command. This is an internal helper function
- * used by iSYS_setMultipleTargetFilter().
+ * Persists the current sensor-side parameters to the device's EEPROM memory.
+ * This ensures that sensor settings survive power cycles and device resets.
  *
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions
  *
- * @note This function validates the acknowledgement frame structure and checksum
- * @note Used internally by iSYS_setMultipleTargetFilter() function
+ * @note This function saves sensor-specific parameters to EEPROM
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Internal usage - called by iSYS_setMultipleTargetFilter()
- *   iSYSResult_t res = receiveSetMultipleTargetFilterAcknowledgement(0x80, 300);
- *   if (res != ERR_OK) {
- *       // Handle acknowledgement error
+ *   // Save sensor settings
+ *   iSYSResult_t res = radar.saveSensorSettings(0x80, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.println("Sensor settings saved");
  *   }
  */
-iSYSResult_t iSYS4001::receiveSetMultipleTargetFilterAcknowledgement(uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::saveSensorSettings(uint8_t destAddress, uint32_t timeout)
 {
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    uint8_t response[9];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
-
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
-    {
-        if (_serial.available())
-        {
-            response[responseIndex++] = _serial.read();
-
-            if (response[responseIndex - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received multiple target filter acknowledgement: ", response, responseIndex);
-
-    if (responseIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    if (responseIndex < 9)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
-
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD5 || response[8] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
-
-    if (responseIndex >= 9)
-    {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
-    }
-
-    return ERR_OK;
+    return sendEEPROMCommand(ISYS_EEPROM_SAVE_SENSOR_SETTINGS, destAddress, timeout);
 }
 
-/***************************************************************
- *  OUTPUT SINGLE TARGET FILTER FUNCTIONS
- ***************************************************************/
+/**
+ * @brief Convenience function to save application settings to EEPROM
+ *
+ * Persists the current application-side parameters to the device's EEPROM memory.
+ * This includes range, velocity, signal, and direction settings for all outputs.
+ *
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ *
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions
+ *
+ * @note This function saves application-specific parameters to EEPROM
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
+ *
+ * @example
+ *   // Save application settings
+ *   iSYSResult_t res = radar.saveApplicationSettings(0x80, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.println("Application settings saved");
+ *   }
+ */
+iSYSResult_t iSYS4001::saveApplicationSettings(uint8_t destAddress, uint32_t timeout)
+{
+    return sendEEPROMCommand(ISYS_EEPROM_SAVE_APPLICATION_SETTINGS, destAddress, timeout);
+}
 
 /**
- * @brief Set the output filter type for single target filtering
+ * @brief Convenience function to save all settings to EEPROM
  *
- * Configures the filter type for single target output on the specified output channel
- * of the iSYS-4001 radar device. This determines how multiple targets are processed
- * to produce a single output value (highest signal, mean, median, min, or max).
+ * Persists both sensor and application parameters to the device's EEPROM memory.
+ * This is equivalent to calling both saveSensorSettings() and saveApplicationSettings().
  *
- * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param filter Filter type (ISYS_OUTPUT_FILTER_HIGHEST_SIGNAL, ISYS_OUTPUT_FILTER_MEAN, ISYS_OUTPUT_FILTER_MEDIAN, ISYS_OUTPUT_FILTER_MIN, or ISYS_OUTPUT_FILTER_MAX)
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
- * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_TIMEOUT: Invalid timeout parameter (0)
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions
  *
- * @note This function configures how multiple targets are processed for single target output
- * @note When using HIGHEST_SIGNAL, signal selection is not required
- * @note Changes take effect immediately but should be saved with saveAllSettings()
+ * @note This function saves both sensor and application parameters to EEPROM
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Set output 1 to use median filter for single target output
- *   iSYSResult_t res = radar.iSYS_setOutputFilterType(ISYS_OUTPUT_1, ISYS_OUTPUT_FILTER_MEDIAN, 0x80, 300);
+ *   // Save all settings
+ *   iSYSResult_t res = radar.saveAllSettings(0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.println("Output filter type set successfully");
+ *       Serial.println("All settings saved");
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_setOutputFilterType(iSYSOutputNumber_t outputnumber, iSYSOutput_filter_t filter, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::saveAllSettings(uint8_t destAddress, uint32_t timeout)
 {
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
-    {
-        return ERR_OUTPUT_OUT_OF_RANGE;
-    }
-
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    iSYSResult_t res = sendSetOutputFilterRequest(outputnumber, filter, destAddress);
-    if (res != ERR_OK)
-    {
-        return res;
-    }
-
-    res = receiveSetOutputFilterAcknowledgement(destAddress, timeout);
-    if (res != ERR_OK)
-    {
-        return res;
-    }
-
-    return ERR_OK;
+    return sendEEPROMCommand(ISYS_EEPROM_SAVE_ALL_SETTINGS, destAddress, timeout);
 }
 
+// EEPROM commands for ISYS_PRECOMPUTED_ADDRESS, indexed by sub-function - 1, built by the compiler
+static const uint8_t *const precomputedEEPROMCommands[4] = {
+    iSYSEEPROMFrame<ISYS_PRECOMPUTED_ADDRESS, ISYS_EEPROM_SET_FACTORY_SETTINGS>::bytes,
+    iSYSEEPROMFrame<ISYS_PRECOMPUTED_ADDRESS, ISYS_EEPROM_SAVE_SENSOR_SETTINGS>::bytes,
+    iSYSEEPROMFrame<ISYS_PRECOMPUTED_ADDRESS, ISYS_EEPROM_SAVE_APPLICATION_SETTINGS>::bytes,
+    iSYSEEPROMFrame<ISYS_PRECOMPUTED_ADDRESS, ISYS_EEPROM_SAVE_ALL_SETTINGS>::bytes};
+
 /**
- * @brief Internal function to send output filter type request to radar device
+ * @brief Internal function to send EEPROM command frame to radar device
  *
- * Constructs and transmits a command frame to set the output filter type
- * for single target filtering on the specified output channel of the iSYS-4001
- * radar device. This is an internal helper function used by iSYS_setOutputFilterType().
+ * Constructs and transmits a command frame for EEPROM operations to the
+ * iSYS-4001 radar device. This is an internal helper function used by
+ * sendEEPROMCommand() to send the actual command frame.
  *
- * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param filter Filter type (ISYS_OUTPUT_FILTER_HIGHEST_SIGNAL, ISYS_OUTPUT_FILTER_MEAN, ISYS_OUTPUT_FILTER_MEDIAN, ISYS_OUTPUT_FILTER_MIN, or ISYS_OUTPUT_FILTER_MAX)
+ * @param subFunction EEPROM sub-function to execute (ISYS_EEPROM_SET_FACTORY_SETTINGS, ISYS_EEPROM_SAVE_SENSOR_SETTINGS, etc.)
  * @param destAddress Device Radar Destination address (typically 0x80)
  *
  * @return iSYSResult_t ERR_OK on success, or error code if command transmission fails
  *
  * @note This function only sends the command - it does not wait for or process the response
- * @note Used internally by iSYS_setOutputFilterType() function
+ * @note Used internally by sendEEPROMCommand() function
  * @note The command frame includes proper framing, address, and checksum validation
+ * @note Requests to ISYS_PRECOMPUTED_ADDRESS send a frame built at compile time (see iSYSFrames.h)
  *
  * @example
- *   // Internal usage - called by iSYS_setOutputFilterType()
- *   iSYSResult_t res = sendSetOutputFilterRequest(ISYS_OUTPUT_1, ISYS_OUTPUT_FILTER_MEDIAN, 0x80);
+ *   // Internal usage - called by sendEEPROMCommand()
+ *   iSYSResult_t res = sendEEPROMCommandFrame(ISYS_EEPROM_SAVE_APPLICATION_SETTINGS, 0x80);
  *   if (res != ERR_OK) {
  *       // Handle command transmission error
  *   }
  */
-iSYSResult_t iSYS4001::sendSetOutputFilterRequest(iSYSOutputNumber_t outputnumber, iSYSOutput_filter_t filter, uint8_t destAddress)
+iSYSResult_t iSYS4001::sendEEPROMCommandFrame(iSYSEEPROMSubFunction_t subFunction, uint8_t destAddress)
 {
-    uint8_t command[13];
+    if (destAddress == ISYS_PRECOMPUTED_ADDRESS && subFunction >= ISYS_EEPROM_SET_FACTORY_SETTINGS && subFunction <= ISYS_EEPROM_SAVE_ALL_SETTINGS)
+    {
+        const uint8_t *frame = precomputedEEPROMCommands[subFunction - ISYS_EEPROM_SET_FACTORY_SETTINGS];
+        debugPrintHexFrame("Sending EEPROM command to radar: ", frame, 10);
+        return sendFrame(frame, 10);
+    }
+
+    uint8_t command[10];
     uint8_t index = 0;
 
     command[index++] = 0x68;
-    command[index++] = 0x07;
-    command[index++] = 0x07;
+    command[index++] = 0x04;
+    command[index++] = 0x04;
     command[index++] = 0x68;
     command[index++] = destAddress;
     command[index++] = 0x01;
-    command[index++] = 0xD5;
-    command[index++] = outputnumber;
-    command[index++] = 0x15;
-    command[index++] = 0x00;
-    command[index++] = (uint8_t)filter;
+    command[index++] = 0xDF;
+    command[index++] = subFunction;
 
-    uint8_t fcs = calculateFCS(command, 4, index - 1);
+    uint8_t fcs = calculateFCS(command, 4, 7);
     command[index++] = fcs;
     command[index++] = 0x16;
 
-    debugPrintHexFrame("Setting output filter type command to radar: ", command, 13);
-
-    size_t bytesWritten = _serial.write(command, 13);
-    _serial.flush();
-
-    if (bytesWritten != 13)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
+    debugPrintHexFrame("Sending EEPROM command to radar: ", command, 10);
 
-    return ERR_OK;
+    return sendFrame(command, 10);
 }
-
 /**
- * @brief Internal function to receive output filter type acknowledgement from radar device
+ * @brief Internal function to receive EEPROM command acknowledgement from radar device
  *
  * Waits for and validates the acknowledgement response from the iSYS-4001 radar device
- * after sending an output filter type command. This is an internal helper function
- * used by iSYS_setOutputFilterType().
+ * after sending an EEPROM command. This is an internal helper function used by
+ * sendEEPROMCommand() to validate the command was received and processed.
  *
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for acknowledgement
@@ -3384,334 +4053,236 @@ iSYSResult_t iSYS4001::sendSetOutputFilterRequest(iSYSOutputNumber_t outputnumbe
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
  * @note This function validates the acknowledgement frame structure and checksum
- * @note Used internally by iSYS_setOutputFilterType() function
+ * @note Used internally by sendEEPROMCommand() function
+ * @note EEPROM operations take effect immediately after acknowledgement
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Internal usage - called by iSYS_setOutputFilterType()
- *   iSYSResult_t res = receiveSetOutputFilterAcknowledgement(0x80, 300);
+ *   // Internal usage - called by sendEEPROMCommand()
+ *   iSYSResult_t res = receiveEEPROMAcknowledgement(0x80, 300);
  *   if (res != ERR_OK) {
  *       // Handle acknowledgement error
  *   }
  */
-iSYSResult_t iSYS4001::receiveSetOutputFilterAcknowledgement(uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::receiveEEPROMAcknowledgement(uint8_t destAddress, uint32_t timeout)
 {
     if (timeout == 0)
     {
         return ERR_TIMEOUT;
     }
 
-    uint8_t response[9];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
-
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
-    {
-        if (_serial.available())
-        {
-            response[responseIndex++] = _serial.read();
-
-            if (response[responseIndex - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received output filter acknowledgement: ", response, responseIndex);
-
-    if (responseIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    if (responseIndex < 9)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
+    return awaitResponse(ISYS_RESPONSE_ACK, 0xDF, destAddress, nullptr, timeout, "Received EEPROM acknowledgement: ");
+}
 
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD5 || response[8] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
+/***************************************************************
+ *  CALCULATE CHECKSUM FUNCTION
+ ***************************************************************/
+/**
+ * @brief Calculate frame checksum (FCS) for radar communication
+ *
+ * Computes an additive checksum across a specified range of bytes in a frame.
+ * The checksum is used by the iSYS-4001 radar device to validate the integrity
+ * of transmitted and received command/response frames.
+ *
+ * @param data Pointer to byte array containing the frame data
+ * @param startIndex Index of the first byte to include in the checksum
+ * @param endIndex Index of the last byte to include in the checksum
+ *
+ * @return uint8_t The computed checksum value
+ *
+ * @note The checksum is calculated as the 8-bit sum of all bytes between
+ *       startIndex and endIndex (inclusive).
+ *
+ * @example
+ *   // Example: calculate checksum for command frame
+ *   uint8_t command[] = {0x68, 0x05, 0x05, 0x68, 0x80, 0x01, 0xD4, 0x01, 0x16};
+ *   uint8_t fcs = radar.calculateFCS(command, 4, 7);
+ *   Serial.print("Calculated FCS: ");
+ *   Serial.println(fcs, HEX);
+ */
 
-    if (responseIndex >= 9)
+uint8_t iSYS4001::calculateFCS(const uint8_t *data, uint8_t startIndex, uint8_t endIndex)
+{
+    uint8_t fcs = 0;
+    for (uint8_t i = startIndex; i <= endIndex; i++)
     {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
+        fcs = (uint8_t)(fcs + data[i]);
     }
-
-    return ERR_OK;
+    return fcs;
 }
 
+/***************************************************************
+ *  DEVICE ADDRESS FUNCTIONS
+ ***************************************************************/
+
 /**
- * @brief Get the current output filter type for single target filtering
+ * @brief Set the device address for the radar sensor
  *
- * Retrieves the current filter type setting for single target output on the
- * specified output channel from the iSYS-4001 radar device. This shows how
- * multiple targets are currently being processed to produce a single output value.
+ * Changes the DESTINATION address of the iSYS-4001 radar device.
+ * After setting a new address, all subsequent communications must use the new address.
  *
- * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param filter Pointer to iSYSOutput_filter_t variable that will receive the current filter type
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for response
+ * @param deviceaddress New device address to set (typically 0x80-0xFF)
+ * @param destAddress Current known address of the device (0x00 can be used if unknown)
+ * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_NULL_POINTER: filter pointer is null
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
  *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
  *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
  *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note The returned filter value indicates how multiple targets are processed for single target output
+ * @note After setting a new address, subsequent communications must use the new address
+ * @note Consider persisting configuration with EEPROM commands if required
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Get current filter type for output 1
- *   iSYSOutput_filter_t currentFilter;
- *   iSYSResult_t res = radar.iSYS_getOutputFilterType(ISYS_OUTPUT_1, &currentFilter, 0x80, 300);
+ *   // Set device address to 0x81, communicating to current device at 0x80
+ *   iSYSResult_t res = radar.iSYS_setDeviceAddress(0x81, 0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.print("Current filter type: ");
- *       Serial.println(currentFilter);
+ *       Serial.println("Device address changed to 0x81");
+ *       // Now use 0x81 for all subsequent communications
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_getOutputFilterType(iSYSOutputNumber_t outputnumber, iSYSOutput_filter_t *filter, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_setDeviceAddress(uint8_t deviceaddress, uint8_t destAddress, uint32_t timeout)
 {
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
-    {
-        return ERR_OUTPUT_OUT_OF_RANGE;
-    }
-
-    if (filter == nullptr)
-    {
-        return ERR_NULL_POINTER;
-    }
-
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    iSYSResult_t res = sendGetOutputFilterRequest(outputnumber, destAddress);
-    if (res != ERR_OK)
-    {
-        return res;
-    }
-
-    res = receiveGetOutputFilterResponse(filter, destAddress, timeout);
-    if (res != ERR_OK)
-    {
-        return res;
-    }
-
-    return ERR_OK;
+    return setParameter(ISYS_PARAMETER_DEVICE_ADDRESS, 0, deviceaddress, destAddress, timeout);
 }
 
 /**
- * @brief Internal function to send get output filter type request to radar device
+ * @brief Get the current device address of the radar sensor
  *
- * Constructs and transmits a command frame to request the current output filter type
- * setting for single target filtering on the specified output channel of the iSYS-4001
- * radar device. This is an internal helper function used by iSYS_getOutputFilterType().
+ * Retrieves the current device/destination address of the iSYS-4001 radar device. This is useful
+ * for discovering the address of a device when it's unknown, or for verification
+ * after setting a new address.
  *
- * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param deviceaddress Pointer to uint8_t variable that will receive the current device address
+ * @param destAddress Current known address of the device (0x00 can be used if unknown)
+ * @param timeout Maximum time in milliseconds to wait for response
  *
- * @return iSYSResult_t ERR_OK on success, or error code if command transmission fails
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_NULL_POINTER: deviceaddress pointer is null
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function only sends the command - it does not wait for or process the response
- * @note Used internally by iSYS_getOutputFilterType() function
- * @note The command frame includes proper framing, address, and checksum validation
+ * @note This function can be used to discover the address of an unknown device
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Internal usage - called by iSYS_getOutputFilterType()
- *   iSYSResult_t res = sendGetOutputFilterRequest(ISYS_OUTPUT_1, 0x80);
- *   if (res != ERR_OK) {
- *       // Handle command transmission error
+ *   // Get current device address
+ *   uint8_t currentAddress = 0;
+ *   iSYSResult_t res = radar.iSYS_getDeviceAddress(&currentAddress, 0x00, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.print("Current device address: 0x");
+ *       Serial.println(currentAddress, HEX);
  *   }
  */
-iSYSResult_t iSYS4001::sendGetOutputFilterRequest(iSYSOutputNumber_t outputnumber, uint8_t destAddress)
+iSYSResult_t iSYS4001::iSYS_getDeviceAddress(uint8_t *deviceaddress, uint8_t destAddress, uint32_t timeout)
 {
-    uint8_t command[11];
-    uint8_t index = 0;
-
-    command[index++] = 0x68;
-    command[index++] = 0x05;
-    command[index++] = 0x05;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD4;
-    command[index++] = outputnumber;
-    command[index++] = 0x15;
-
-    uint8_t fcs = calculateFCS(command, 4, index - 1);
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Getting output filter type command to radar: ", command, 11);
-
-    size_t bytesWritten = _serial.write(command, 11);
-    _serial.flush();
-
-    if (bytesWritten != 11)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    return ERR_OK;
+    return getParameter(ISYS_PARAMETER_DEVICE_ADDRESS, 0, deviceaddress, destAddress, timeout);
 }
 
+/***************************************************************
+ *  ACQUISITION CONTROL FUNCTIONS
+ ***************************************************************/
+
 /**
- * @brief Receive and parse output filter type response from radar
- *
- * Waits for and validates the response frame from the iSYS-4001 radar device
- * after sending a request for the current output filter type. The function
- * extracts the filter type from the response and returns it via the provided
- * pointer.
+ * @brief Start radar acquisition on the device
  *
- * @param filter Pointer to iSYSOutput_filter_t variable that will receive the current output filter type
- * @param destAddress Device Radar Destination address (typically 0x80)
- * @param timeout Maximum time in milliseconds to wait for response
+ * Initiates the measurement cycle on the iSYS-4001 radar device. This function
+ * must be called before attempting to request target data or stream measurements.
+ * The device will begin actively scanning and detecting targets after this command.
  *
- * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
- *         - ERR_TIMEOUT: Timeout parameter is zero
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response received within timeout
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame shorter than expected
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ *
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
  *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ *         - ERR_COMMAND_MAX_DATA_OVERFLOW: Response exceeds internal buffer
  *
- * @note This function should be called after sending the corresponding
- *       request function (sendGetOutputFilterRequest()).
- * @note The received filter value indicates which type of output filtering
- *       is currently active on the device.
+ * @note Start acquisition before attempting to stream or repeatedly request data
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @note Flush stale UART bytes before issuing commands for improved reliability
  *
  * @example
- *   // Receive and process response for output filter type
- *   iSYSOutput_filter_t currentFilter;
- *   iSYSResult_t res = radar.receiveGetOutputFilterResponse(&currentFilter, 0x80, 300);
+ *   // Start radar acquisition
+ *   iSYSResult_t res = radar.iSYS_startAcquisition(0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.print("Output filter type received: ");
- *       Serial.println(currentFilter);
- *   } else {
- *       Serial.print("Error receiving filter type: ");
- *       Serial.println(res);
+ *       Serial.println("Radar acquisition started");
+ *       // Now can request target data
  *   }
  */
-
-iSYSResult_t iSYS4001::receiveGetOutputFilterResponse(iSYSOutput_filter_t *filter, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_startAcquisition(uint8_t destAddress, uint32_t timeout)
 {
     if (timeout == 0)
     {
         return ERR_TIMEOUT;
     }
 
-    uint8_t response[11];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
-
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
-    {
-        if (_serial.available())
-        {
-            response[responseIndex++] = _serial.read();
-
-            if (response[responseIndex - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received output filter response: ", response, responseIndex);
-
-    if (responseIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    if (responseIndex < 11)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
-
-    if (response[0] != 0x68 || response[1] != 0x05 || response[2] != 0x05 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD4 || response[7] != 0x00 || response[10] != 0x16)
+    iSYSResult_t res = sendAcquisitionCommand(destAddress, true);
+    if (res != ERR_OK)
     {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
+        return res;
     }
 
-    if (responseIndex >= 11)
+    res = receiveAcquisitionAcknowledgement(destAddress, timeout);
+    if (res != ERR_OK)
     {
-        uint8_t expectedFCS = calculateFCS(response, 4, 8);
-        if (response[9] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
+        return res;
     }
 
-    *filter = (iSYSOutput_filter_t)response[8];
     return ERR_OK;
 }
 
 /**
- * @brief Set the output signal filter for a channel
+ * @brief Stop radar acquisition on the device
  *
- * Sends a request to the iSYS-4001 radar device to configure the signal filter
- * type for a specified output channel, and waits for the acknowledgement frame
- * to confirm successful application of the setting.
+ * Halts the measurement cycle on the iSYS-4001 radar device. This function
+ * stops the device from actively scanning and detecting targets.
  *
- * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param signal Desired signal filter type to set (value from iSYSFilter_signal_t)
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
- * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
- *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_TIMEOUT: Timeout parameter is zero
- *         - ERR_COMMAND_NO_DATA_RECEIVED: Failed to send request or no acknowledgement received
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Acknowledgement frame shorter than expected
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Acknowledgement frame structure invalid
- *         - ERR_INVALID_CHECKSUM: Acknowledgement checksum validation failed
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ *         - ERR_COMMAND_MAX_DATA_OVERFLOW: Response exceeds internal buffer
  *
- * @note This is a high-level function that internally calls
- *       sendSetOutputSignalFilterRequest() and
- *       receiveSetOutputSignalFilterAcknowledgement().
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
+ * @note Flush stale  bytes before issuing commands for improved reliability
  *
  * @example
- *   // Set output 2 to use HIGHEST_SIGNAL filter type
- *   iSYSResult_t res = radar.iSYS_setOutputSignalFilter(ISYS_OUTPUT_2, ISYS_FILTER_SIGNAL_HIGHEST, 0x80, 300);
+ *   // Stop radar acquisition
+ *   iSYSResult_t res = radar.iSYS_stopAcquisition(0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.println("Output signal filter successfully configured");
- *   } else {
- *       Serial.print("Failed to set output signal filter, error: ");
- *       Serial.println(res);
+ *       Serial.println("Radar acquisition stopped");
+ *       // Can now change device settings if needed
  *   }
  */
-
-iSYSResult_t iSYS4001::iSYS_setOutputSignalFilter(iSYSOutputNumber_t outputnumber, iSYSFilter_signal_t signal, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_stopAcquisition(uint8_t destAddress, uint32_t timeout)
 {
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
-    {
-        return ERR_OUTPUT_OUT_OF_RANGE;
-    }
-
     if (timeout == 0)
     {
         return ERR_TIMEOUT;
     }
 
-    iSYSResult_t res = sendSetOutputSignalFilterRequest(outputnumber, signal, destAddress);
+    iSYSResult_t res = sendAcquisitionCommand(destAddress, false);
     if (res != ERR_OK)
     {
         return res;
     }
 
-    res = receiveSetOutputSignalFilterAcknowledgement(destAddress, timeout);
+    res = receiveAcquisitionAcknowledgement(destAddress, timeout);
     if (res != ERR_OK)
     {
         return res;
@@ -3721,369 +4292,298 @@ iSYSResult_t iSYS4001::iSYS_setOutputSignalFilter(iSYSOutputNumber_t outputnumbe
 }
 
 /**
- * @brief Send request to set the output signal filter for a channel
+ * @brief Internal function to send acquisition start/stop command to radar device
  *
- * Constructs and transmits a command frame to the iSYS-4001 radar device
- * instructing it to change the signal filter setting for the specified
- * output channel. The radar should reply with an acknowledgement frame,
- * which must be validated using receiveSetOutputSignalFilterAcknowledgement().
+ * Constructs and transmits a command frame to start or stop radar acquisition
+ * on the iSYS-4001 device. This is an internal helper function used by
+ * iSYS_startAcquisition() and iSYS_stopAcquisition().
  *
- * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param signal Desired signal filter type to set (value from iSYSFilter_signal_t)
  * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param start If true, starts acquisition; if false, stops acquisition
  *
- * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
- *         - ERR_COMMAND_NO_DATA_RECEIVED: Failed to write full request frame to serial
+ * @return iSYSResult_t ERR_OK on success, or error code if command transmission fails
  *
- * @note This function only sends the request; the acknowledgement must be
- *       received separately to confirm success.
+ * @note This function only sends the command - it does not wait for or process the response
+ * @note Used internally by iSYS_startAcquisition() and iSYS_stopAcquisition() functions
+ * @note The command frame includes proper framing, address, and checksum validation
+ * @note Requests to ISYS_PRECOMPUTED_ADDRESS send a frame built at compile time (see iSYSFrames.h)
  *
  * @example
- *   // Set signal filter for output 1 to HIGHEST_SIGNAL
- *   iSYSResult_t res = radar.sendSetOutputSignalFilterRequest(ISYS_OUTPUT_1, ISYS_FILTER_SIGNAL_HIGHEST, 0x80);
- *   if (res == ERR_OK) {
- *       // Wait for acknowledgement
- *       res = radar.receiveSetOutputSignalFilterAcknowledgement(0x80, 300);
- *       if (res == ERR_OK) {
- *           Serial.println("Signal filter successfully updated");
- *       } else {
- *           Serial.println("Failed to receive acknowledgement");
- *       }
- *   } else {
- *       Serial.println("Failed to send set filter command");
+ *   // Internal usage - called by iSYS_startAcquisition()
+ *   iSYSResult_t res = sendAcquisitionCommand(0x80, true);
+ *   if (res != ERR_OK) {
+ *       // Handle error
  *   }
  */
-
-iSYSResult_t iSYS4001::sendSetOutputSignalFilterRequest(iSYSOutputNumber_t outputnumber, iSYSFilter_signal_t signal, uint8_t destAddress)
+iSYSResult_t iSYS4001::sendAcquisitionCommand(uint8_t destAddress, bool start)
 {
-    uint8_t command[13];
+    if (destAddress == ISYS_PRECOMPUTED_ADDRESS)
+    {
+        const uint8_t *frame = start ? iSYSAcquisitionFrame<ISYS_PRECOMPUTED_ADDRESS, true>::bytes
+                                     : iSYSAcquisitionFrame<ISYS_PRECOMPUTED_ADDRESS, false>::bytes;
+        debugPrintHexFrame(start ? "Starting acquisition command to radar: " : "Stopping acquisition command to radar: ", frame, 11);
+        return sendFrame(frame, 11);
+    }
+
+    uint8_t command[11];
     uint8_t index = 0;
 
     command[index++] = 0x68;
-    command[index++] = 0x07;
-    command[index++] = 0x07;
+    command[index++] = 0x05;
+    command[index++] = 0x05;
     command[index++] = 0x68;
     command[index++] = destAddress;
     command[index++] = 0x01;
-    command[index++] = 0xD5;
-    command[index++] = outputnumber;
-    command[index++] = 0x16;
+    command[index++] = 0xD1;
     command[index++] = 0x00;
-    command[index++] = (uint8_t)signal;
+    command[index++] = start ? 0x00 : 0x01;
 
-    uint8_t fcs = calculateFCS(command, 4, index - 1);
+    uint8_t fcs = calculateFCS(command, 4, 8);
     command[index++] = fcs;
     command[index++] = 0x16;
 
-    debugPrintHexFrame("Setting output signal filter command to radar: ", command, 13);
-
-    size_t bytesWritten = _serial.write(command, 13);
-    _serial.flush();
-
-    if (bytesWritten != 13)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
+    debugPrintHexFrame(start ? "Starting acquisition command to radar: " : "Stopping acquisition command to radar: ", command, 11);
 
-    return ERR_OK;
+    return sendFrame(command, 11);
 }
 
 /**
- * @brief Receive and validate acknowledgement for setting output signal filter
+ * @brief Internal function to receive acquisition command acknowledgement from radar device
  *
- * Waits for and parses the acknowledgement frame from the iSYS-4001 radar device
- * after sending a "set output signal filter" command. The acknowledgement
- * confirms that the radar has accepted and applied the requested filter change.
+ * Waits for and validates the acknowledgement response from the iSYS-4001 radar device
+ * after sending an acquisition start/stop command. This is an internal helper function
+ * used by iSYS_startAcquisition() and iSYS_stopAcquisition().
  *
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
- * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
- *         - ERR_TIMEOUT: Timeout parameter is zero
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No acknowledgement received within timeout
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Acknowledgement frame shorter than expected
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Frame structure invalid (header, address, or command mismatch)
- *         - ERR_INVALID_CHECKSUM: Acknowledgement checksum validation failed
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function should be called after sending a set output signal filter request
- * @note The acknowledgement frame does not return a signal value, only confirmation
+ * @note This function validates the acknowledgement frame structure and checksum
+ * @note Used internally by iSYS_startAcquisition() and iSYS_stopAcquisition() functions
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Receive acknowledgement after setting signal filter
- *   iSYSResult_t res = radar.receiveSetOutputSignalFilterAcknowledgement(0x80, 300);
- *   if (res == ERR_OK) {
- *       Serial.println("Signal filter successfully set");
- *   } else {
- *       Serial.print("Failed to receive acknowledgement, error: ");
- *       Serial.println(res);
+ *   // Internal usage - called by iSYS_startAcquisition()
+ *   iSYSResult_t res = receiveAcquisitionAcknowledgement(0x80, 300);
+ *   if (res != ERR_OK) {
+ *       // Handle acknowledgement error
  *   }
  */
-
-iSYSResult_t iSYS4001::receiveSetOutputSignalFilterAcknowledgement(uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::receiveAcquisitionAcknowledgement(uint8_t destAddress, uint32_t timeout)
 {
     if (timeout == 0)
     {
         return ERR_TIMEOUT;
     }
 
-    uint8_t response[9];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
-
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
-    {
-        if (_serial.available())
-        {
-            response[responseIndex++] = _serial.read();
-
-            if (response[responseIndex - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received output signal filter acknowledgement: ", response, responseIndex);
-
-    if (responseIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
+    return awaitResponse(ISYS_RESPONSE_ACK, 0xD1, destAddress, nullptr, timeout, "Received acquisition acknowledgement: ");
+}
 
-    if (responseIndex < 9)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
+/***************************************************************
+ *  OUTPUT MULTIPLE TARGET FILTER FUNCTIONS
+ ***************************************************************/
 
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD5 || response[8] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
+/**
+ * @brief Set multiple target filter for a specified output channel
+ *
+ * Configures the multiple target filtering for the specified output channel
+ * on the iSYS-4001 radar device. This function specifically handles signal
+ * selection for multiple target filtering and always sets the signal filter
+ * to ISYS_OFF for multiple target operation.This is used when users want to 
+ * scan multiple targets.
+ *
+ * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ *
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ *
+ * @note This function is specifically for multiple target filtering
+ * @note The signal filter is always set to ISYS_OFF for multiple target filtering
+ * @note Changes take effect immediately but should be saved with saveAllSettings()
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
+ *
+ * @example
+ *   // Set multiple target filter for output 1
+ *   iSYSResult_t res = radar.iSYS_setMultipleTargetFilter(ISYS_OUTPUT_1, 0x80, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.println("Multiple target filter set successfully");
+ *   }
+ */
+iSYSResult_t iSYS4001::iSYS_setMultipleTargetFilter(iSYSOutputNumber_t outputnumber, uint8_t destAddress, uint32_t timeout)
+{
+    // Multiple targets are reported when the single target signal filter is off
+    return setParameter(ISYS_PARAMETER_SIGNAL_FILTER, outputnumber, (uint16_t)ISYS_OFF, destAddress, timeout);
+}
 
-    if (responseIndex >= 9)
-    {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
-    }
+/***************************************************************
+ *  OUTPUT SINGLE TARGET FILTER FUNCTIONS
+ ***************************************************************/
 
-    return ERR_OK;
+/**
+ * @brief Set the output filter type for single target filtering
+ *
+ * Configures the filter type for single target output on the specified output channel
+ * of the iSYS-4001 radar device. This determines how multiple targets are processed
+ * to produce a single output value (highest signal, mean, median, min, or max).
+ *
+ * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param filter Filter type (ISYS_OUTPUT_FILTER_HIGHEST_SIGNAL, ISYS_OUTPUT_FILTER_MEAN, ISYS_OUTPUT_FILTER_MEDIAN, ISYS_OUTPUT_FILTER_MIN, or ISYS_OUTPUT_FILTER_MAX)
+ * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for acknowledgement
+ *
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
+ *
+ * @note This function configures how multiple targets are processed for single target output
+ * @note When using HIGHEST_SIGNAL, signal selection is not required
+ * @note Changes take effect immediately but should be saved with saveAllSettings()
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
+ *
+ * @example
+ *   // Set output 1 to use median filter for single target output
+ *   iSYSResult_t res = radar.iSYS_setOutputFilterType(ISYS_OUTPUT_1, ISYS_OUTPUT_FILTER_MEDIAN, 0x80, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.println("Output filter type set successfully");
+ *   }
+ */
+iSYSResult_t iSYS4001::iSYS_setOutputFilterType(iSYSOutputNumber_t outputnumber, iSYSOutput_filter_t filter, uint8_t destAddress, uint32_t timeout)
+{
+    return setParameter(ISYS_PARAMETER_FILTER_TYPE, outputnumber, (uint16_t)filter, destAddress, timeout);
 }
 
 /**
- * @brief Get the current output signal filter setting for single target filtering
+ * @brief Get the current output filter type for single target filtering
  *
- * Retrieves the current signal filter setting for single target output on the
- * specified output channel from the iSYS-4001 radar device. This shows which
- * signal type is currently being used for filtering multiple targets.
+ * Retrieves the current filter type setting for single target output on the
+ * specified output channel from the iSYS-4001 radar device. This shows how
+ * multiple targets are currently being processed to produce a single output value.
  *
  * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
- * @param signal Pointer to iSYSFilter_signal_t variable that will receive the current signal filter
+ * @param filter Pointer to iSYSOutput_filter_t variable that will receive the current filter type
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for response
  *
  * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
  *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
- *         - ERR_NULL_POINTER: signal pointer is null
+ *         - ERR_NULL_POINTER: filter pointer is null
  *         - ERR_TIMEOUT: Invalid timeout parameter (0)
  *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
  *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
  *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note The returned signal value indicates which signal type is used for filtering
- * @note When using HIGHEST_SIGNAL filter type, signal selection is not required
+ * @note The returned filter value indicates how multiple targets are processed for single target output
  * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Get current signal filter for output 1
- *   iSYSFilter_signal_t currentSignal;
- *   iSYSResult_t res = radar.iSYS_getOutputSignalFilter(ISYS_OUTPUT_1, &currentSignal, 0x80, 300);
+ *   // Get current filter type for output 1
+ *   iSYSOutput_filter_t currentFilter;
+ *   iSYSResult_t res = radar.iSYS_getOutputFilterType(ISYS_OUTPUT_1, &currentFilter, 0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.print("Current signal filter: ");
- *       Serial.println(currentSignal);
+ *       Serial.print("Current filter type: ");
+ *       Serial.println(currentFilter);
  *   }
  */
-iSYSResult_t iSYS4001::iSYS_getOutputSignalFilter(iSYSOutputNumber_t outputnumber, iSYSFilter_signal_t *signal, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_getOutputFilterType(iSYSOutputNumber_t outputnumber, iSYSOutput_filter_t *filter, uint8_t destAddress, uint32_t timeout)
 {
-    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
-    {
-        return ERR_OUTPUT_OUT_OF_RANGE;
-    }
-
-    if (signal == nullptr)
-    {
-        return ERR_NULL_POINTER;
-    }
-
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    iSYSResult_t res = sendGetOutputSignalFilterRequest(outputnumber, destAddress);
-    if (res != ERR_OK)
-    {
-        return res;
-    }
-
-    res = receiveGetOutputSignalFilterResponse(signal, destAddress, timeout);
-    if (res != ERR_OK)
-    {
-        return res;
-    }
-
-    return ERR_OK;
+    return getParameter(ISYS_PARAMETER_FILTER_TYPE, outputnumber, filter, destAddress, timeout);
 }
 
 /**
- * @brief Send request to retrieve current output signal filter setting
+ * @brief Set the output signal filter for a channel
  *
- * Constructs and transmits a request frame to the iSYS-4001 radar device asking
- * for the current signal filter setting on the specified output channel. The
- * radar will respond with a frame containing the active filter configuration.
+ * Sends a request to the iSYS-4001 radar device to configure the signal filter
+ * type for a specified output channel, and waits for the acknowledgement frame
+ * to confirm successful application of the setting.
  *
- * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param outputnumber Output channel to configure (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ * @param signal Desired signal filter type to set (value from iSYSFilter_signal_t)
  * @param destAddress Device Radar Destination address (typically 0x80)
+ * @param timeout Maximum time in milliseconds to wait for acknowledgement
  *
  * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
- *         - ERR_COMMAND_NO_DATA_RECEIVED: Failed to write full request frame to serial
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_TIMEOUT: Timeout parameter is zero
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: Failed to send request or no acknowledgement received
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Acknowledgement frame shorter than expected
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Acknowledgement frame structure invalid
+ *         - ERR_INVALID_CHECKSUM: Acknowledgement checksum validation failed
  *
- * @note The response must be parsed using iSYS4001::receiveGetOutputSignalFilterResponse()
- * @note This function only sends the request; it does not wait for or validate the response
+ * @note Sent through the parameter command engine (see setParameter())
  *
  * @example
- *   // Send request to get current signal filter for output 1
- *   iSYSResult_t res = radar.sendGetOutputSignalFilterRequest(ISYS_OUTPUT_1, 0x80);
- *   if (res != ERR_OK) {
- *       Serial.println("Failed to send request frame");
+ *   // Set output 2 to use HIGHEST_SIGNAL filter type
+ *   iSYSResult_t res = radar.iSYS_setOutputSignalFilter(ISYS_OUTPUT_2, ISYS_FILTER_SIGNAL_HIGHEST, 0x80, 300);
+ *   if (res == ERR_OK) {
+ *       Serial.println("Output signal filter successfully configured");
+ *   } else {
+ *       Serial.print("Failed to set output signal filter, error: ");
+ *       Serial.println(res);
  *   }
  */
 
-iSYSResult_t iSYS4001::sendGetOutputSignalFilterRequest(iSYSOutputNumber_t outputnumber, uint8_t destAddress)
+iSYSResult_t iSYS4001::iSYS_setOutputSignalFilter(iSYSOutputNumber_t outputnumber, iSYSFilter_signal_t signal, uint8_t destAddress, uint32_t timeout)
 {
-    uint8_t command[11];
-    uint8_t index = 0;
-
-    command[index++] = 0x68;
-    command[index++] = 0x05;
-    command[index++] = 0x05;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD4;
-    command[index++] = outputnumber;
-    command[index++] = 0x16;
-
-    uint8_t fcs = calculateFCS(command, 4, index - 1);
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Getting output signal filter command to radar: ", command, 11);
-
-    size_t bytesWritten = _serial.write(command, 11);
-    _serial.flush();
-
-    if (bytesWritten != 11)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    return ERR_OK;
+    return setParameter(ISYS_PARAMETER_SIGNAL_FILTER, outputnumber, (uint16_t)signal, destAddress, timeout);
 }
 
 /**
- * @brief Receive and parse output signal filter response from radar
+ * @brief Get the current output signal filter setting for single target filtering
  *
- * Waits for and validates the response frame from the iSYS-4001 radar device
- * after sending a request for the current signal filter configuration. The
- * function extracts the signal filter type from the response and returns it
- * via the provided pointer.
+ * Retrieves the current signal filter setting for single target output on the
+ * specified output channel from the iSYS-4001 radar device. This shows which
+ * signal type is currently being used for filtering multiple targets.
  *
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
  * @param signal Pointer to iSYSFilter_signal_t variable that will receive the current signal filter
  * @param destAddress Device Radar Destination address (typically 0x80)
  * @param timeout Maximum time in milliseconds to wait for response
  *
- * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
- *         - ERR_TIMEOUT: Timeout parameter is zero
- *         - ERR_COMMAND_NO_DATA_RECEIVED: No response received within timeout
- *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame shorter than expected
- *         - ERR_COMMAND_RX_FRAME_DAMAGED: Frame structure invalid (header, address, or command mismatch)
+ * @return iSYSResult_t ERR_OK on success, or error code for various failure conditions:
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_NULL_POINTER: signal pointer is null
+ *         - ERR_TIMEOUT: Invalid timeout parameter (0)
+ *         - ERR_COMMAND_NO_DATA_RECEIVED: No response from device
+ *         - ERR_COMMAND_RX_FRAME_LENGTH: Response frame too short
+ *         - ERR_COMMAND_RX_FRAME_DAMAGED: Response frame structure invalid
  *         - ERR_INVALID_CHECKSUM: Response checksum validation failed
  *
- * @note This function should be called after sendGetOutputSignalFilterRequest()
- * @note The received signal value indicates which filter type is active on the device
+ * @note The returned signal value indicates which signal type is used for filtering
+ * @note When using HIGHEST_SIGNAL filter type, signal selection is not required
+ * @note Recommended timeout is >= 100ms (300ms used in examples)
  *
  * @example
- *   // Receive and process response for output signal filter
+ *   // Get current signal filter for output 1
  *   iSYSFilter_signal_t currentSignal;
- *   iSYSResult_t res = radar.receiveGetOutputSignalFilterResponse(&currentSignal, 0x80, 300);
+ *   iSYSResult_t res = radar.iSYS_getOutputSignalFilter(ISYS_OUTPUT_1, &currentSignal, 0x80, 300);
  *   if (res == ERR_OK) {
- *       Serial.print("Signal filter received: ");
+ *       Serial.print("Current signal filter: ");
  *       Serial.println(currentSignal);
- *   } else {
- *       Serial.print("Error receiving filter response: ");
- *       Serial.println(res);
  *   }
  */
-
-iSYSResult_t iSYS4001::receiveGetOutputSignalFilterResponse(iSYSFilter_signal_t *signal, uint8_t destAddress, uint32_t timeout)
+iSYSResult_t iSYS4001::iSYS_getOutputSignalFilter(iSYSOutputNumber_t outputnumber, iSYSFilter_signal_t *signal, uint8_t destAddress, uint32_t timeout)
 {
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    uint8_t response[11];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
-
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
-    {
-        if (_serial.available())
-        {
-            response[responseIndex++] = _serial.read();
-
-            if (response[responseIndex - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received output signal filter response: ", response, responseIndex);
-
-    if (responseIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    if (responseIndex < 11)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
-
-    if (response[0] != 0x68 || response[1] != 0x05 || response[2] != 0x05 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD4 || response[7] != 0x00 || response[10] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
-
-    if (responseIndex >= 11)
-    {
-        uint8_t expectedFCS = calculateFCS(response, 4, 8);
-        if (response[9] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
-    }
-
-    *signal = (iSYSFilter_signal_t)response[8];
-    return ERR_OK;
+    return getParameter(ISYS_PARAMETER_SIGNAL_FILTER, outputnumber, signal, destAddress, timeout);
 }
 
-
 /***************************************************************
  *  SET/GET RANGE BOUND FUNCTIONS
  **************************************************************/
@@ -4121,83 +4621,7 @@ iSYSResult_t iSYS4001::receiveGetOutputSignalFilterResponse(iSYSFilter_signal_t
  */
 iSYSResult_t iSYS4001::iSYS_setRangeBound(iSYSRangeBound_t bound, uint8_t destAddress, uint32_t timeout)
 {
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    uint8_t command[13];
-    uint8_t index = 0;
-
-    command[index++] = 0x68;
-    command[index++] = 0x07;
-    command[index++] = 0x07;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD3;
-    command[index++] = 0x00;
-    command[index++] = 0x10;
-    command[index++] = 0x00;
-    command[index++] = (bound == ISYS_RANGE_0_TO_150) ? 0x01 : 0x00;
-
-    uint8_t fcs = calculateFCS(command, 4, 10);
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Sending SET range bound command: ", command, sizeof(command));
-
-    size_t bytesWritten = _serial.write(command, sizeof(command));
-    _serial.flush();
-
-    if (bytesWritten != sizeof(command))
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    uint8_t response[9];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
-
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
-    {
-        if (_serial.available())
-        {
-            response[responseIndex++] = _serial.read();
-            if (response[responseIndex - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received SET range bound acknowledgement: ", response, responseIndex);
-
-    if (responseIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    if (responseIndex < 9)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
-
-    if (response[0] != 0x68 || response[1] != 0x03 || response[2] != 0x03 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD3 || response[8] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
-
-    if (responseIndex >= 9)
-    {
-        uint8_t expectedFCS = calculateFCS(response, 4, 6);
-        if (response[7] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
-    }
-
-    return ERR_OK;
+    return setParameter(ISYS_PARAMETER_RANGE_BOUND, 0, (bound == ISYS_RANGE_0_TO_150) ? 0x01 : 0x00, destAddress, timeout);
 }
 
 /**
@@ -4229,84 +4653,7 @@ iSYSResult_t iSYS4001::iSYS_setRangeBound(iSYSRangeBound_t bound, uint8_t destAd
  */
 iSYSResult_t iSYS4001::iSYS_getRangeBound(iSYSRangeBound_t *bound, uint8_t destAddress, uint32_t timeout)
 {
-    if (bound == NULL)
-        return ERR_NULL_POINTER;
-
-    if (timeout == 0)
-    {
-        return ERR_TIMEOUT;
-    }
-
-    uint8_t command[11];
-    uint8_t index = 0;
-
-    command[index++] = 0x68;
-    command[index++] = 0x05;
-    command[index++] = 0x05;
-    command[index++] = 0x68;
-    command[index++] = destAddress;
-    command[index++] = 0x01;
-    command[index++] = 0xD2;
-    command[index++] = 0x00;
-    command[index++] = 0x10;
-    uint8_t fcs = calculateFCS(command, 4, 8);
-    command[index++] = fcs;
-    command[index++] = 0x16;
-
-    debugPrintHexFrame("Sending GET range bound command: ", command, sizeof(command));
-
-    size_t bytesWritten = _serial.write(command, sizeof(command));
-    _serial.flush();
-    if (bytesWritten != sizeof(command))
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    uint8_t response[11];
-    size_t responseIndex = 0;
-    uint32_t startTime = millis();
-
-    while ((millis() - startTime) < timeout && responseIndex < sizeof(response))
-    {
-        if (_serial.available())
-        {
-            response[responseIndex++] = _serial.read();
-            if (response[responseIndex - 1] == 0x16)
-                break;
-        }
-    }
-
-    debugPrintHexFrame("Received GET range bound response: ", response, responseIndex);
-
-    if (responseIndex == 0)
-    {
-        return ERR_COMMAND_NO_DATA_RECEIVED;
-    }
-
-    if (responseIndex < 11)
-    {
-        return ERR_COMMAND_RX_FRAME_LENGTH;
-    }
-
-    if (response[0] != 0x68 || response[1] != 0x05 || response[2] != 0x05 ||
-        response[3] != 0x68 || response[4] != 0x01 || response[5] != destAddress ||
-        response[6] != 0xD2 || response[10] != 0x16)
-    {
-        return ERR_COMMAND_RX_FRAME_DAMAGED;
-    }
-
-    if (responseIndex >= 11)
-    {
-        uint8_t expectedFCS = calculateFCS(response, 4, 8);
-        if (response[9] != expectedFCS)
-        {
-            return ERR_INVALID_CHECKSUM;
-        }
-    }
-
-    // Payload carries value 0x00 (near/50m) or 0x01 (far/150m)
-    *bound = (response[8] == 0x01) ? ISYS_RANGE_0_TO_150 : ISYS_RANGE_0_TO_50;
-    return ERR_OK;
+    return getParameter(ISYS_PARAMETER_RANGE_BOUND, 0, bound, destAddress, timeout);
 }
 
 
@@ -1,7 +1,19 @@
 #ifndef ISYS4001_H
 #define ISYS4001_H
 
+#if defined(ARDUINO)
 #include <Arduino.h>
+#else
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#endif
+#include "iSYSCapture.h"
+#include "iSYSFrameParser.h"
+#include "iSYSFrames.h"
+#include "iSYSTransport.h"
 
 // Define sint16_t as a 16-bit signed integer for pointer compatibility
 #if !defined(sint16_t)
@@ -11,6 +23,38 @@ typedef int16_t sint16_t;
 // Define MAX_TARGETS constant
 #define MAX_TARGETS (0x23)
 
+// Debug output target: an Arduino Stream (e.g. Serial), or a stdio stream (e.g. stderr) on host builds
+#if defined(ARDUINO)
+typedef Stream iSYSDebugStream_t;
+#else
+typedef FILE iSYSDebugStream_t;
+#endif
+
+// Binary capture target (see iSYSCapture.h): any stream accepted for debug output, e.g. an SD card File
+typedef iSYSDebugStream_t iSYSCaptureStream_t;
+
+// Requests iSYS_setOutputConfig() keeps in flight before it waits for acknowledgements;
+// 1 sends one request per acknowledgement, for links that drop back-to-back frames
+#ifndef ISYS_CONFIG_PIPELINE_DEPTH
+#define ISYS_CONFIG_PIPELINE_DEPTH (3)
+#endif
+
+// Column capacity of iSYSTargetArrays_t: MAX_TARGETS rounded up to whole 4-float vectors
+#define ISYS_TARGET_ARRAY_CAPACITY ((MAX_TARGETS + 3) & ~3)
+
+// Alignment of the iSYSTargetArrays_t columns in bytes: one 128-bit vector register
+// (SSE, NEON, ESP32-S3). AVR has no vector unit and no alignment requirement.
+#ifndef ISYS_TARGET_ARRAY_ALIGNMENT
+#if defined(__AVR__)
+#define ISYS_TARGET_ARRAY_ALIGNMENT (1)
+#else
+#define ISYS_TARGET_ARRAY_ALIGNMENT (16)
+#endif
+#endif
+
+// Largest frame the sensor sends: 32-bit target list header (6) + 14 bytes per target + FCS + end delimiter
+#define ISYS_MAX_FRAME_LENGTH (6 + (14 * MAX_TARGETS) + 2)
+
 /**
  * @brief Result/error codes for iSYS radar sensor API calls
  *
@@ -41,7 +85,11 @@ typedef enum
     ERR_FRAME_INCOMPLETE = 11,
 
     // ===== COMMAND ERRORS =====
-    ERR_COMMAND_FAILURE = 12
+    ERR_COMMAND_FAILURE = 12,
+
+    // ===== NON-BLOCKING MODE =====
+    ERR_TRANSACTION_PENDING = 13, // request sent, completion is reported through poll()
+    ERR_TRANSACTION_BUSY = 14     // another transaction is still waiting for its response
 
 } iSYSResult_t;
 
@@ -54,6 +102,13 @@ typedef enum iSYSTargetListError
     TARGET_LIST_ACQUISITION_NOT_STARTED
 } iSYSTargetListError_t;
 
+typedef enum iSYSTransactionState
+{
+    ISYS_TRANSACTION_IDLE = 0, // no request sent yet
+    ISYS_TRANSACTION_PENDING,  // request sent, waiting for the response
+    ISYS_TRANSACTION_COMPLETE  // response handled (or timed out), result available
+} iSYSTransactionState_t;
+
 typedef enum iSYSOutput_filter
 {
     ISYS_OUTPUT_FILTER_HIGHEST_SIGNAL = 0,
@@ -115,28 +170,413 @@ typedef struct iSYSTargetList
     iSYSTarget_t targets[MAX_TARGETS];
 } iSYSTargetList_t;
 
+/**
+ * @brief Target list stored as one array per field (structure of arrays)
+ *
+ * Holds the same data as iSYSTargetList_t, but target i is signal[i], velocity[i],
+ * range[i] and angle[i]. Each column is aligned to ISYS_TARGET_ARRAY_ALIGNMENT and
+ * padded to ISYS_TARGET_ARRAY_CAPACITY, so code that processes one field of every
+ * target (gating, clustering, tracking) reads contiguous memory and can use whole
+ * vector loads. Entries from nrOfTargets up to the next multiple of 4 are always 0,
+ * so the last vector of a loop over nrOfTargets reads zeros past the list; the
+ * entries after that are only cleared with setTargetListZeroFill(true).
+ *
+ * Filled by the iSYSTargetArrays_t overloads of getTargetList16/32(),
+ * startTargetListStream16/32() and decodeTargetList(); convert with
+ * iSYS4001::targetArraysToList() and iSYS4001::targetListToArrays().
+ *
+ * @example
+ *   static iSYSTargetArrays_t targets;
+ *   if (radar.getTargetList32(&targets, 0x80, 300) == ERR_OK) {
+ *       float nearest = 150.0f;
+ *       for (uint16_t i = 0; i < targets.nrOfTargets; i++) {
+ *           nearest = (targets.range[i] < nearest) ? targets.range[i] : nearest;
+ *       }
+ *   }
+ */
+typedef struct iSYSTargetArrays
+{
+    union iSYSTargetListError_u error;
+    uint8_t outputNumber;
+    uint16_t nrOfTargets;
+    uint32_t clippingFlag;
+    alignas(ISYS_TARGET_ARRAY_ALIGNMENT) float signal[ISYS_TARGET_ARRAY_CAPACITY];   /* signal indicator dB */
+    alignas(ISYS_TARGET_ARRAY_ALIGNMENT) float velocity[ISYS_TARGET_ARRAY_CAPACITY]; /* velocity in m/s */
+    alignas(ISYS_TARGET_ARRAY_ALIGNMENT) float range[ISYS_TARGET_ARRAY_CAPACITY];    /* range in m */
+    alignas(ISYS_TARGET_ARRAY_ALIGNMENT) float angle[ISYS_TARGET_ARRAY_CAPACITY];    /* angle of detected object [°/Deg] */
+} iSYSTargetArrays_t;
+
+/**
+ * @brief Target in the sensor's integer units
+ *
+ * 32-bit target lists arrive in exactly these units and are stored without any
+ * arithmetic; 16-bit lists (dB, cm/s, cm) are widened with one integer multiply.
+ * No floating point is involved, which matters on boards without an FPU
+ * (AVR, Cortex-M0), where every float multiply is a library call.
+ * The iSYSTarget*() accessors below convert a field to float on demand.
+ */
+typedef struct iSYSTargetFixed
+{
+    int16_t signal;   /* signal indicator in 0.01 dB */
+    int32_t velocity; /* velocity in mm/s */
+    int32_t range;    /* range in µm */
+    int32_t angle;    /* angle of detected object in 0.01° */
+} iSYSTargetFixed_t;
+
+/**
+ * @brief Target list in integer fixed-point units
+ *
+ * Same header fields as iSYSTargetList_t. Filled by the iSYSTargetListFixed_t
+ * overloads of getTargetList16/32(), startTargetListStream16/32() and
+ * decodeTargetList(); iSYS4001::targetListFixedToList() converts a whole list.
+ *
+ * @example
+ *   iSYSTargetListFixed_t targets;
+ *   if (radar.getTargetList16(&targets, 0x80, 300) == ERR_OK) {
+ *       for (uint16_t i = 0; i < targets.nrOfTargets; i++) {
+ *           if (targets.targets[i].range < 2000000L) { // closer than 2 m
+ *               Serial.println(iSYSTargetRange(&targets.targets[i]));
+ *           }
+ *       }
+ *   }
+ */
+typedef struct iSYSTargetListFixed
+{
+    union iSYSTargetListError_u error;
+    uint8_t outputNumber;
+    uint16_t nrOfTargets;
+    uint32_t clippingFlag;
+    iSYSTargetFixed_t targets[MAX_TARGETS];
+} iSYSTargetListFixed_t;
+
+// Signal indicator in dB
+inline float iSYSTargetSignal(const iSYSTargetFixed_t *target)
+{
+    return (float)target->signal * 0.01f;
+}
+
+// Velocity in m/s
+inline float iSYSTargetVelocity(const iSYSTargetFixed_t *target)
+{
+    return (float)target->velocity * 0.001f;
+}
+
+// Range in m
+inline float iSYSTargetRange(const iSYSTargetFixed_t *target)
+{
+    return (float)target->range * 1E-6f;
+}
+
+// Angle in degrees
+inline float iSYSTargetAngle(const iSYSTargetFixed_t *target)
+{
+    return (float)target->angle * 0.01f;
+}
+
 typedef enum iSYSRangeBound
 {
     ISYS_RANGE_0_TO_50 = 0, // use this when want to set range between 0.0m to 50.0m
     ISYS_RANGE_0_TO_150 = 1 // use this when want to set range between 0.0m to 150.0m
 } iSYSRangeBound_t;
 
+/**
+ * @brief Complete filter configuration of one output channel
+ *
+ * Written in one pipelined batch by iSYS_setOutputConfig(). Units and valid ranges
+ * are those of the individual setters.
+ */
+typedef struct iSYSOutputConfig
+{
+    uint16_t rangeMin;                  // m, 0 to 149
+    uint16_t rangeMax;                  // m, 1 to 150
+    uint16_t velocityMin;               // km/h, 0 to 249
+    uint16_t velocityMax;               // km/h, 1 to 250
+    uint16_t signalMin;                 // dB, 0 to 249
+    uint16_t signalMax;                 // dB, 1 to 250
+    iSYSDirection_type_t direction;     // targets reported by direction of movement
+    iSYSOutput_filter_t filterType;     // single target filter
+    iSYSFilter_signal_t signalFilter;   // signal the single target filter works on
+} iSYSOutputConfig_t;
+
+// Fields of iSYSOutputConfig_t, in the order they are sent; indexes the per-field results
+typedef enum iSYSOutputConfigField
+{
+    ISYS_CONFIG_RANGE_MIN = 0,
+    ISYS_CONFIG_RANGE_MAX,
+    ISYS_CONFIG_VELOCITY_MIN,
+    ISYS_CONFIG_VELOCITY_MAX,
+    ISYS_CONFIG_SIGNAL_MIN,
+    ISYS_CONFIG_SIGNAL_MAX,
+    ISYS_CONFIG_DIRECTION,
+    ISYS_CONFIG_FILTER_TYPE,
+    ISYS_CONFIG_SIGNAL_FILTER,
+    ISYS_CONFIG_FIELD_COUNT
+} iSYSOutputConfigField_t;
+
+/**
+ * @brief Filter configuration of one output as read back from the sensor
+ *
+ * Units are those of the individual getters.
+ */
+typedef struct iSYSOutputSnapshot
+{
+    float rangeMin;                   // m
+    float rangeMax;                   // m
+    float velocityMin;                // km/h
+    float velocityMax;                // km/h
+    float signalMin;                  // dB
+    float signalMax;                  // dB
+    iSYSDirection_type_t direction;
+    iSYSOutput_filter_t filterType;
+    iSYSFilter_signal_t signalFilter;
+} iSYSOutputSnapshot_t;
+
+// Bits of iSYSConfigurationSnapshot_t::valid
+#define ISYS_SNAPSHOT_OUTPUT_BIT(outputnumber, field) (1UL << ((field) * 3 + (outputnumber) - ISYS_OUTPUT_1))
+#define ISYS_SNAPSHOT_RANGE_BOUND_BIT (1UL << 27)
+#define ISYS_SNAPSHOT_DEVICE_ADDRESS_BIT (1UL << 28)
+
+/**
+ * @brief Every readable parameter of one sensor, filled by readConfiguration()
+ *
+ * valid has a bit set for each value that was read successfully: use
+ * ISYS_SNAPSHOT_OUTPUT_BIT(ISYS_OUTPUT_2, ISYS_CONFIG_RANGE_MAX) for output values
+ * and ISYS_SNAPSHOT_RANGE_BOUND_BIT / ISYS_SNAPSHOT_DEVICE_ADDRESS_BIT for the others.
+ */
+typedef struct iSYSConfigurationSnapshot
+{
+    iSYSOutputSnapshot_t outputs[3]; // index 0 is ISYS_OUTPUT_1
+    iSYSRangeBound_t rangeBound;
+    uint8_t deviceAddress;
+    uint32_t valid;
+} iSYSConfigurationSnapshot_t;
+
+/**
+ * @brief Link-health counters of one iSYS4001 instance
+ *
+ * Always maintained; all counters start at zero and wrap on overflow. Read a
+ * consistent snapshot with getLinkStats().
+ */
+typedef struct iSYSLinkStats
+{
+    uint32_t framesSent;       // request frames written to the transport
+    uint32_t framesReceived;   // complete frames assembled by the frame parser
+    uint32_t bytesOut;         // bytes written to the transport
+    uint32_t bytesIn;          // bytes read from the transport
+    uint32_t checksumFailures; // transactions ended with ERR_INVALID_CHECKSUM
+    uint32_t incompleteFrames; // transactions ended with ERR_FRAME_INCOMPLETE
+    uint32_t damagedFrames;    // transactions ended with ERR_COMMAND_RX_FRAME_DAMAGED
+    uint32_t unrelatedFrames;  // complete frames that did not answer the pending request
+    uint32_t timeouts;         // transactions that ran into their timeout
+    uint32_t resyncBytes;      // bytes skipped by the frame parser while resynchronising
+    uint32_t clippingEvents;   // target lists received with the clipping flag (0xFF)
+} iSYSLinkStats_t;
+
+// Cache entries: 9 per-output parameters for each of the 3 outputs, range bound, device address
+#define ISYS_PARAMETER_CACHE_ENTRIES (29)
+
+/**
+ * @brief Storage for the parameter cache, provided by the application
+ *
+ * Holds the last value confirmed by one device for every parameter, in the device's
+ * 16-bit format. 64 bytes; only allocated by applications that call setParameterCache().
+ */
+typedef struct iSYSParameterCache
+{
+    uint8_t address;                               // device the entries belong to
+    uint32_t valid;                                // one bit per entry
+    uint16_t values[ISYS_PARAMETER_CACHE_ENTRIES]; // raw values as sent and received
+} iSYSParameterCache_t;
+
+// Command classes with their own latency histograms
+typedef enum iSYSCommandClass
+{
+    ISYS_COMMAND_TARGET_LIST = 0, // 0xDA
+    ISYS_COMMAND_GET,             // 0xD4
+    ISYS_COMMAND_SET,             // 0xD5
+    ISYS_COMMAND_ACQUISITION,     // 0xD1
+    ISYS_COMMAND_DEVICE,          // 0xD2/0xD3 (range bound, device address)
+    ISYS_COMMAND_EEPROM,          // 0xDF
+    ISYS_COMMAND_CLASS_COUNT
+} iSYSCommandClass_t;
+
+// Measurement points of a transaction, both counted from the end of the request
+typedef enum iSYSLatencyPoint
+{
+    ISYS_LATENCY_FIRST_BYTE = 0, // first byte received after the request
+    ISYS_LATENCY_COMPLETE,       // matching response frame complete
+    ISYS_LATENCY_POINT_COUNT
+} iSYSLatencyPoint_t;
+
+// Number of fixed histogram buckets; limits in µs are returned by iSYS4001::getLatencyBucketLimit()
+#define ISYS_LATENCY_BUCKETS (16)
+
+/**
+ * @brief Fixed-bucket latency histogram of one command class and measurement point
+ *
+ * buckets[i] counts samples up to getLatencyBucketLimit(i) µs that did not fit an
+ * earlier bucket; the last bucket is unbounded.
+ */
+typedef struct iSYSLatencyHistogram
+{
+    uint32_t count;    // samples recorded
+    uint32_t timeouts; // transactions that ended before this point was reached
+    uint32_t min;      // µs, valid when count > 0
+    uint32_t max;      // µs
+    uint32_t buckets[ISYS_LATENCY_BUCKETS];
+} iSYSLatencyHistogram_t;
+
+/**
+ * @brief Storage for all latency histograms, provided by the application
+ *
+ * 960 bytes; only allocated by applications that call setLatencyStats().
+ */
+typedef struct iSYSLatencyStats
+{
+    iSYSLatencyHistogram_t histograms[ISYS_COMMAND_CLASS_COUNT][ISYS_LATENCY_POINT_COUNT];
+} iSYSLatencyStats_t;
+
+// Default floor in ms of timeouts derived by setAdaptiveTimeout()
+#define ISYS_ADAPTIVE_MIN_TIMEOUT (10)
+
+/**
+ * @brief Response time estimate of one command class, TCP retransmission timer style
+ *
+ * Updated from every answered request (RFC 6298 smoothing); the derived timeout is
+ * srtt + max(1 ms, 4 * rttvar), doubled for every consecutive timeout.
+ */
+typedef struct iSYSRttEstimate
+{
+    uint32_t srtt;    // µs, smoothed response time, valid when samples > 0
+    uint32_t rttvar;  // µs, smoothed mean deviation of the response time
+    uint32_t samples; // responses measured
+    uint8_t backoff;  // consecutive timeouts since the last response
+} iSYSRttEstimate_t;
+
+/**
+ * @brief State of the adaptive timeouts, provided by the application
+ *
+ * About 100 bytes; only allocated by applications that call setAdaptiveTimeout(). Static
+ * storage starts at zero, i.e. without estimates.
+ */
+typedef struct iSYSAdaptiveTimeout
+{
+    uint32_t minTimeout; // ms, floor of every derived timeout
+    iSYSRttEstimate_t estimates[ISYS_COMMAND_CLASS_COUNT];
+} iSYSAdaptiveTimeout_t;
+
 class iSYS4001
 {
 
 public:
+#if defined(ARDUINO)
     iSYS4001(HardwareSerial &serial, uint32_t baud = 115200);
+#endif
+    iSYS4001(iSYSTransport &transport);
+
+    iSYSTransport &getTransport();
 
     /***************************************************************
      *  DEBUG FUNCTIONS
      ***************************************************************/
-    iSYSResult_t setDebug(Stream &stream, bool enabled);
+    iSYSResult_t setDebug(iSYSDebugStream_t &stream, bool enabled);
+    iSYSResult_t setCapture(iSYSCaptureStream_t &stream, bool enabled);
+
+    /***************************************************************
+     *  LINK STATISTICS FUNCTIONS
+     ***************************************************************/
+    iSYSResult_t getLinkStats(iSYSLinkStats_t *stats);
+    void resetLinkStats();
+
+    /***************************************************************
+     *  LATENCY STATISTICS FUNCTIONS
+     ***************************************************************/
+    iSYSResult_t setLatencyStats(iSYSLatencyStats_t *stats);
+    void resetLatencyStats();
+    const iSYSLatencyHistogram_t *getLatencyHistogram(iSYSCommandClass_t commandClass, iSYSLatencyPoint_t point);
+    uint32_t getLatencyPercentile(iSYSCommandClass_t commandClass, iSYSLatencyPoint_t point, uint16_t permille);
+    static uint32_t getLatencyBucketLimit(uint8_t bucket);
+
+    /***************************************************************
+     *  ADAPTIVE TIMEOUT FUNCTIONS
+     ***************************************************************
+     * NOTE:
+     * With adaptive timeouts enabled, the timeout passed to each call is
+     * an upper limit. The driver waits only as long as the learned response
+     * time of the command class requires.
+     ***************************************************************/
+    iSYSResult_t setAdaptiveTimeout(iSYSAdaptiveTimeout_t *state, uint32_t minTimeout = ISYS_ADAPTIVE_MIN_TIMEOUT);
+    void resetAdaptiveTimeout();
+    uint32_t getAdaptiveTimeout(iSYSCommandClass_t commandClass, uint32_t timeout);
+
+    /***************************************************************
+     *  PARAMETER CACHE FUNCTIONS
+     ***************************************************************
+     * NOTE:
+     * With a cache set, parameter getters for the cached device are
+     * answered locally once a value is known, and setters that would
+     * write the value the device already holds return ERR_OK without
+     * sending. Both finish at once, also in non-blocking mode.
+     ***************************************************************/
+    iSYSResult_t setParameterCache(iSYSParameterCache_t *cache, uint8_t destAddress);
+    void invalidateParameterCache();
+
+    /***************************************************************
+     *  NON-BLOCKING MODE FUNCTIONS
+     ***************************************************************
+     * NOTE:
+     * With non-blocking mode enabled every call below sends its request and
+     * returns ERR_TRANSACTION_PENDING right away. Call poll() from loop() until
+     * it reports ISYS_TRANSACTION_COMPLETE, then read getTransactionResult().
+     ***************************************************************/
+    iSYSResult_t setNonBlocking(bool enabled);
+    iSYSTransactionState_t poll();
+    iSYSTransactionState_t getTransactionState();
+    iSYSResult_t getTransactionResult();
 
     /***************************************************************
      *  GET TARGET LIST FUNCTION
+     ***************************************************************
+     * NOTE:
+     * Only the nrOfTargets valid entries of a list are written; the
+     * entries past them keep whatever they held before. Call
+     * setTargetListZeroFill(true) if your code relies on zeroed tails.
      ***************************************************************/
+    void setTargetListZeroFill(bool enabled);
+    bool getTargetListZeroFill();
     iSYSResult_t getTargetList16(iSYSTargetList_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
     iSYSResult_t getTargetList32(iSYSTargetList_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
+    iSYSResult_t decodeTargetList(const uint8_t *frame, uint16_t length, iSYSTargetList_t *pTargetList);
+
+    // Same requests, decoded into one array per field (see iSYSTargetArrays_t)
+    iSYSResult_t getTargetList16(iSYSTargetArrays_t *pTargetArrays, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
+    iSYSResult_t getTargetList32(iSYSTargetArrays_t *pTargetArrays, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
+    iSYSResult_t decodeTargetList(const uint8_t *frame, uint16_t length, iSYSTargetArrays_t *pTargetArrays);
+    static void targetArraysToList(const iSYSTargetArrays_t *pTargetArrays, iSYSTargetList_t *pTargetList);
+    static void targetListToArrays(const iSYSTargetList_t *pTargetList, iSYSTargetArrays_t *pTargetArrays);
+
+    // Same requests, decoded into integer fixed-point units (see iSYSTargetListFixed_t)
+    iSYSResult_t getTargetList16(iSYSTargetListFixed_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
+    iSYSResult_t getTargetList32(iSYSTargetListFixed_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
+    iSYSResult_t decodeTargetList(const uint8_t *frame, uint16_t length, iSYSTargetListFixed_t *pTargetList);
+    static void targetListFixedToList(const iSYSTargetListFixed_t *pFixedList, iSYSTargetList_t *pTargetList);
+
+    /***************************************************************
+     *  TARGET LIST STREAMING FUNCTIONS
+     ***************************************************************
+     * NOTE:
+     * A stream requests the next target list as soon as the current
+     * response has arrived and decodes the current one while the sensor
+     * answers. Drive it with poll(); each poll() that returns
+     * ISYS_TRANSACTION_COMPLETE has refreshed the target list.
+     ***************************************************************/
+    iSYSResult_t startTargetListStream16(iSYSTargetList_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
+    iSYSResult_t startTargetListStream32(iSYSTargetList_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
+    iSYSResult_t startTargetListStream16(iSYSTargetArrays_t *pTargetArrays, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
+    iSYSResult_t startTargetListStream32(iSYSTargetArrays_t *pTargetArrays, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
+    iSYSResult_t startTargetListStream16(iSYSTargetListFixed_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
+    iSYSResult_t startTargetListStream32(iSYSTargetListFixed_t *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
+    iSYSResult_t stopTargetListStream();
 
 
     /***************************************************************
@@ -202,6 +642,27 @@ public:
     iSYSResult_t iSYS_setOutputDirection(iSYSOutputNumber_t outputnumber, iSYSDirection_type_t direction, uint8_t destAddress, uint32_t timeout);
     iSYSResult_t iSYS_getOutputDirection(iSYSOutputNumber_t outputnumber, iSYSDirection_type_t *direction, uint8_t destAddress, uint32_t timeout);
 
+    /***************************************************************
+     *  OUTPUT CONFIGURATION FUNCTIONS
+     ***************************************************************
+     * NOTE:
+     * Writes every filter parameter of one output with pipelined 0xD5
+     * requests and one timeout for the whole batch. results receives the
+     * outcome of each field, indexed by iSYSOutputConfigField_t.
+     ***************************************************************/
+
+    iSYSResult_t iSYS_setOutputConfig(iSYSOutputNumber_t outputnumber, const iSYSOutputConfig_t *config, iSYSResult_t results[ISYS_CONFIG_FIELD_COUNT], uint8_t destAddress, uint32_t timeout);
+
+    /***************************************************************
+     *  CONFIGURATION SNAPSHOT FUNCTIONS
+     ***************************************************************
+     * NOTE:
+     * Reads every parameter of all three outputs plus range bound and
+     * device address with pipelined requests under one timeout.
+     ***************************************************************/
+
+    iSYSResult_t readConfiguration(iSYSConfigurationSnapshot_t *snapshot, uint8_t destAddress, uint32_t timeout);
+
     /***************************************************************
      *  EEPROM COMMAND FUNCTIONS
      ***************************************************************/
@@ -235,9 +696,110 @@ public:
 
 private:
     uint32_t _baud;
-    HardwareSerial &_serial;
+#if defined(ARDUINO)
+    iSYSArduinoTransport _serialTransport; // used by the HardwareSerial constructor
+#endif
+    iSYSTransport *_transport;
     bool _debugEnabled;
-    Stream *_debugStream; // e.g., &Serial, &Serial1
+    iSYSDebugStream_t *_debugStream; // e.g., &Serial, &Serial1 (stderr on host builds)
+    bool _captureEnabled;
+    iSYSCaptureStream_t *_captureStream; // binary capture of every TX/RX frame
+    iSYSLatencyStats_t *_latencyStats;    // application-owned, nullptr while not recording
+    iSYSAdaptiveTimeout_t *_adaptiveTimeout; // application-owned, nullptr for fixed timeouts
+    iSYSParameterCache_t *_parameterCache; // application-owned, nullptr while not caching
+    iSYSLinkStats_t _linkStats;
+    uint32_t _resyncBaseline; // parser discardedBytes() at the last resetLinkStats()
+
+    // Receive buffer owned by the instance so response handling never touches the heap
+    uint8_t _rxBuffer[ISYS_MAX_FRAME_LENGTH];
+    iSYSFrameParser _parser; // assembles frames in _rxBuffer
+
+    /***************************************************************
+     *  TRANSACTION STATE
+     ***************************************************************/
+
+    // Response layouts understood by the transaction engine
+    typedef enum
+    {
+        ISYS_RESPONSE_ACK = 0,        // 9-byte acknowledgement without payload
+        ISYS_RESPONSE_RANGE,          // 16-bit value in 0.1 m
+        ISYS_RESPONSE_VELOCITY,       // 16-bit value in 0.1 m/s
+        ISYS_RESPONSE_SIGNAL,         // 16-bit value in 0.1 dB
+        ISYS_RESPONSE_DIRECTION,      // iSYSDirection_type_t in the low byte
+        ISYS_RESPONSE_FILTER_TYPE,    // iSYSOutput_filter_t in the low byte
+        ISYS_RESPONSE_SIGNAL_FILTER,  // iSYSFilter_signal_t in the low byte
+        ISYS_RESPONSE_DEVICE_ADDRESS, // device address in the low byte
+        ISYS_RESPONSE_RANGE_BOUND,    // 0x00 = 0-50 m, 0x01 = 0-150 m
+        ISYS_RESPONSE_TARGET_LIST_16, // variable-length 16-bit target list
+        ISYS_RESPONSE_TARGET_LIST_32  // variable-length 32-bit target list
+    } iSYSResponseType_t;
+
+    // Structure a target list response is decoded into
+    typedef enum
+    {
+        ISYS_TARGET_LAYOUT_LIST = 0, // iSYSTargetList_t
+        ISYS_TARGET_LAYOUT_ARRAYS,   // iSYSTargetArrays_t
+        ISYS_TARGET_LAYOUT_FIXED     // iSYSTargetListFixed_t
+    } iSYSTargetLayout_t;
+
+    typedef struct
+    {
+        iSYSTransactionState_t state;
+        iSYSResult_t result;
+        iSYSResponseType_t type;
+        uint8_t functionCode;    // function code the response must carry
+        uint8_t sourceAddress;   // address the response must come from
+        bool unrelatedFrame;     // a frame not answering this request was skipped
+        uint32_t startTime;
+        uint32_t timeout;       // ms, effective timeout (adaptive or as requested)
+        uint32_t timeoutLimit;  // ms, timeout requested by the caller
+        uint32_t requestMicros; // micros() at the end of the request, for the latency statistics
+        bool firstByteSeen;     // first-byte latency already recorded
+        uint8_t cacheEntry;     // parameter cache entry confirmed by the response, or ISYS_PARAMETER_CACHE_NONE
+        uint16_t cacheValue;    // raw value written, or read from the response
+        iSYSTargetLayout_t targetLayout; // structure behind output for target list responses
+        bool streamCycle;                // target list stream request; its list header is reset when it ends
+        void *output; // caller-owned destination for the decoded value
+        const char *debugLabel;
+    } iSYSTransaction_t;
+
+    iSYSTransaction_t _transaction;
+    bool _nonBlocking;
+    bool _zeroFill; // clear target list entries past nrOfTargets, see setTargetListZeroFill()
+
+    // Target list stream settings reused for every pipelined request
+    typedef struct
+    {
+        bool active;
+        iSYSOutputNumber_t outputnumber;
+        uint8_t destAddress;
+        uint8_t bitrate;
+    } iSYSStream_t;
+
+    iSYSStream_t _stream;
+
+    // Pipelined parameter requests, see iSYS_setOutputConfig() and readConfiguration()
+    typedef struct
+    {
+        bool active;
+        bool write;                                      // SET requests, else GET requests
+        uint8_t destAddress;
+        uint8_t count;                                   // requests to send
+        uint8_t sent;                                    // requests written
+        uint8_t acked;                                   // responses received
+        uint8_t depth;                                   // requests kept in flight; 1 once the order was in doubt
+        uint8_t confirmed;                               // leading requests whose responses are tied to them and recorded
+        uint8_t suspect;                                 // first request whose response may belong to another, or ISYS_BATCH_NO_SUSPECT
+        uint32_t discarded;                              // parser discardedBytes() when the last response was taken
+        uint32_t unrelated;                              // _linkStats.unrelatedFrames when the last response was taken
+        uint8_t entries[ISYS_PARAMETER_CACHE_ENTRIES];   // parameter entries (cache numbering) in send order
+        uint16_t rawValues[ISYS_PARAMETER_CACHE_ENTRIES]; // SET values to write or GET values read, device format, in send order
+        iSYSResult_t *results;                           // SET: caller-owned, by iSYSOutputConfigField_t
+        iSYSConfigurationSnapshot_t *snapshot;           // GET: caller-owned destination
+        iSYSResult_t firstError;                         // GET: first failed response
+    } iSYSBatch_t;
+
+    iSYSBatch_t _batch;
 
     /***************************************************************
      *  HELPER FUNCTIONS FOR COMMUNICATION AND DECODING
@@ -246,11 +808,37 @@ private:
     // Internal debug helpers (simplified, no return values)
     void debugPrint(const char *msg, bool newline = false);
     void debugPrintHexFrame(const char *prefix, const uint8_t *data, size_t length);
-
-    iSYSResult_t decodeTargetFrame(uint8_t *frame_array, uint16_t nrOfElements, uint8_t bitrate, iSYSTargetList_t *targetList);
+    void captureFrame(iSYSCaptureDirection_t direction, const uint8_t *data, uint16_t length);
+    void recordLatency(iSYSLatencyPoint_t point);
+    void recordLatencyTimeout();
+    void updateResponseTime(bool answered);
+
+    iSYSResult_t sendFrame(const uint8_t *frame, uint8_t length);
+    iSYSResult_t awaitResponse(iSYSResponseType_t type, uint8_t functionCode, uint8_t sourceAddress, void *output, uint32_t timeout, const char *debugLabel);
+    void armTransaction(iSYSResponseType_t type, uint8_t functionCode, uint8_t sourceAddress, void *output, uint32_t timeout, const char *debugLabel);
+    iSYSTransactionState_t completeTransaction(iSYSResult_t result, bool rearmed);
+    void countResult(iSYSResult_t result);
+    bool matchesResponse(const uint8_t *frame, uint16_t length);
+    iSYSResult_t timeoutResult();
+    iSYSResult_t evaluateResponse(const uint8_t *response, uint16_t rxLength);
+
+    template <typename TargetList>
+    iSYSResult_t decodeTargetFrame(uint8_t *frame_array, uint16_t nrOfElements, uint8_t bitrate, TargetList *targetList);
+    template <typename TargetList>
+    iSYSResult_t checkAndDecodeTargetList(const uint8_t *frame, uint16_t length, uint8_t bitrate, bool checksumValid, TargetList *pTargetList);
+    template <typename TargetList>
+    iSYSResult_t getTargetList(TargetList *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber, uint8_t bitrate);
+    template <typename TargetList>
+    iSYSResult_t startTargetListStream(TargetList *pTargetList, uint8_t destAddress, uint32_t timeout, iSYSOutputNumber_t outputnumber, uint8_t bitrate);
     iSYSResult_t sendTargetListRequest(iSYSOutputNumber_t outputnumber, uint8_t destAddress, uint8_t bitrate);
-    iSYSResult_t receiveTargetListResponse(iSYSTargetList_t *pTargetList, uint32_t timeout, uint8_t bitrate);
-    iSYSResult_t decodeTargetList(const uint8_t *data, uint16_t length, iSYSTargetList_t *pTargetList);
+    template <typename TargetList>
+    iSYSResult_t evaluateTargetList(TargetList *pTargetList, const uint8_t *response, uint16_t rxLength, uint8_t bitrate);
+    iSYSResult_t receiveTargetListResponse(void *pTargetList, iSYSTargetLayout_t layout, uint8_t destAddress, uint32_t timeout, uint8_t bitrate);
+    static iSYSTargetLayout_t targetLayout(const iSYSTargetList_t *);
+    static iSYSTargetLayout_t targetLayout(const iSYSTargetArrays_t *);
+    static iSYSTargetLayout_t targetLayout(const iSYSTargetListFixed_t *);
+    bool requestNextStreamFrame();
+    void resetStreamTargetList();
 
     /***************************************************************
      *  EEPROM COMMAND HELPER FUNCTIONS
@@ -268,24 +856,85 @@ private:
     iSYSResult_t receiveAcquisitionAcknowledgement(uint8_t destAddress, uint32_t timeout);
 
     /***************************************************************
-     *  OUTPUT SINGLE TARGET FILTER HELPER FUNCTIONS
+     *  PARAMETER COMMAND ENGINE
      ***************************************************************/
 
-    iSYSResult_t sendSetOutputFilterRequest(iSYSOutputNumber_t outputnumber, iSYSOutput_filter_t filter, uint8_t destAddress);
-    iSYSResult_t receiveSetOutputFilterAcknowledgement(uint8_t destAddress, uint32_t timeout);
-    iSYSResult_t sendGetOutputFilterRequest(iSYSOutputNumber_t outputnumber, uint8_t destAddress);
-    iSYSResult_t receiveGetOutputFilterResponse(iSYSOutput_filter_t *filter, uint8_t destAddress, uint32_t timeout);
-    iSYSResult_t sendSetOutputSignalFilterRequest(iSYSOutputNumber_t outputnumber, iSYSFilter_signal_t signal, uint8_t destAddress);
-    iSYSResult_t receiveSetOutputSignalFilterAcknowledgement(uint8_t destAddress, uint32_t timeout);
-    iSYSResult_t sendGetOutputSignalFilterRequest(iSYSOutputNumber_t outputnumber, uint8_t destAddress);
-    iSYSResult_t receiveGetOutputSignalFilterResponse(iSYSFilter_signal_t *signal, uint8_t destAddress, uint32_t timeout);
+    // Parameters read with 0xD2/0xD4 and written with 0xD3/0xD5
+    typedef enum
+    {
+        ISYS_PARAMETER_RANGE_MIN = 0,
+        ISYS_PARAMETER_RANGE_MAX,
+        ISYS_PARAMETER_VELOCITY_MIN,
+        ISYS_PARAMETER_VELOCITY_MAX,
+        ISYS_PARAMETER_SIGNAL_MIN,
+        ISYS_PARAMETER_SIGNAL_MAX,
+        ISYS_PARAMETER_DIRECTION,
+        ISYS_PARAMETER_FILTER_TYPE,
+        ISYS_PARAMETER_SIGNAL_FILTER,
+        ISYS_PARAMETER_RANGE_BOUND,
+        ISYS_PARAMETER_DEVICE_ADDRESS,
+        ISYS_PARAMETER_COUNT
+    } iSYSParameter_t;
+
+    // Conversion from the caller's unit to the 16-bit value on the wire
+    typedef enum
+    {
+        ISYS_SCALING_RAW = 0,      // value sent as is
+        ISYS_SCALING_TENTHS,       // value * 10 (m -> 0.1 m, dB -> 0.1 dB)
+        ISYS_SCALING_KMH_TO_TENTHS // km/h -> 0.1 m/s, rounded
+    } iSYSParameterScaling_t;
+
+    // Addressing of a parameter, combined in iSYSParameterDescriptor_t::flags
+    typedef enum
+    {
+        ISYS_PARAMETER_PER_OUTPUT = 0x01,    // 0xD4/0xD5 with the output number, else 0xD2/0xD3 with 0x00
+        ISYS_PARAMETER_GET_BROADCAST = 0x02, // GET request goes to address 0x00
+        ISYS_PARAMETER_ACK_FROM_VALUE = 0x04 // SET acknowledgement comes from the address just written
+    } iSYSParameterFlag_t;
+
+    typedef struct
+    {
+        uint8_t subFunction;         // parameter id in byte 8 of the request
+        uint8_t flags;               // iSYSParameterFlag_t bits
+        uint8_t scaling;             // iSYSParameterScaling_t applied to SET values
+        iSYSResponseType_t response; // layout of the GET response
+        uint16_t minValue;           // valid SET values in the caller's unit
+        uint16_t maxValue;
+    } iSYSParameterDescriptor_t;
+
+    static const iSYSParameterDescriptor_t _parameters[ISYS_PARAMETER_COUNT];
+
+    iSYSResult_t encodeParameter(iSYSParameter_t parameter, uint16_t value, uint16_t *rawValue);
+    iSYSResult_t setParameter(iSYSParameter_t parameter, uint8_t outputnumber, uint16_t value, uint8_t destAddress, uint32_t timeout);
+    iSYSResult_t getParameter(iSYSParameter_t parameter, uint8_t outputnumber, void *output, uint8_t destAddress, uint32_t timeout);
+    iSYSResult_t sendParameterRequest(uint8_t functionCode, uint8_t selector, uint8_t subFunction, const uint16_t *rawValue, uint8_t destAddress);
+    void decodeParameterValue(iSYSResponseType_t type, uint16_t rawValue, void *output);
 
     /***************************************************************
-     *  OUTPUT MULTIPLE TARGET FILTER HELPER FUNCTIONS
+     *  PARAMETER CACHE HELPER FUNCTIONS
      ***************************************************************/
 
-    iSYSResult_t sendSetMultipleTargetFilterRequest(iSYSOutputNumber_t outputnumber, uint8_t destAddress);
-    iSYSResult_t receiveSetMultipleTargetFilterAcknowledgement(uint8_t destAddress, uint32_t timeout);
+    static const uint8_t ISYS_PARAMETER_CACHE_NONE = 0xFF;
+
+    static uint8_t parameterEntry(iSYSParameter_t parameter, uint8_t outputnumber);
+    static iSYSParameter_t entryParameter(uint8_t entry, uint8_t *outputnumber);
+    uint8_t cacheEntry(iSYSParameter_t parameter, uint8_t outputnumber, uint8_t destAddress);
+    bool cachedValue(uint8_t entry, uint16_t *rawValue);
+    void storeCachedValue(uint8_t entry, uint16_t rawValue);
+    void invalidateCachedValue(uint8_t entry);
+
+    /***************************************************************
+     *  PARAMETER BATCH HELPER FUNCTIONS
+     ***************************************************************/
+
+    static const uint8_t ISYS_BATCH_NO_SUSPECT = 0xFF;
+
+    iSYSResult_t startBatch(uint32_t timeout, const char *debugLabel);
+    bool sendBatchRequest();
+    void batchResponse(uint8_t entry, iSYSResponseType_t *type, uint8_t *functionCode, void **output);
+    bool advanceBatch(iSYSResult_t result);
+    void recordBatchResult(uint8_t index, iSYSResult_t result);
+    iSYSTransactionState_t finishBatch(iSYSResult_t pending);
 };
 
 #endif
\ No newline at end of file
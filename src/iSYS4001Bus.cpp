@@ -0,0 +1,452 @@
+#include "iSYS4001Bus.h"
+
+/**
+ * @brief Constructor for the iSYS multi-drop bus scheduler
+ *
+ * Creates the iSYS4001 driver instance that owns the serial port. Defaults:
+ * 16-bit target lists, 300 ms response timeout, 100 ms probe timeout, a device is
+ * taken offline after 3 consecutive failures and probed again every 10 rounds.
+ *
+ * @param serial Reference to the HardwareSerial object shared by all sensors
+ * @param baud Baud rate for serial communication (115200 for iSYS-4001)
+ *
+ * @note The constructor does not communicate with any device.
+ *
+ * @example
+ *   iSYS4001Bus bus(Serial2, 115200);
+ */
+#if defined(ARDUINO)
+iSYS4001Bus::iSYS4001Bus(HardwareSerial &serial, uint32_t baud)
+    : _radar(serial, baud)
+{
+    init();
+}
+#endif
+
+/**
+ * @brief Constructor for the bus scheduler on a custom transport
+ *
+ * @param transport Transport shared by all sensors (e.g. iSYSPosixTransport on a Linux gateway)
+ *
+ * @example
+ *   iSYSPosixTransport transport;
+ *   transport.open("/dev/ttyUSB0", 115200);
+ *   iSYS4001Bus bus(transport);
+ */
+iSYS4001Bus::iSYS4001Bus(iSYSTransport &transport)
+    : _radar(transport)
+{
+    init();
+}
+
+/***************************************************************
+ *  CONFIGURATION FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Register a sensor on the bus
+ *
+ * @param address Device address of the sensor (must be unique on the bus)
+ * @param pTargetList Target list that receives this device's data; must stay valid while the bus runs
+ * @param outputnumber Output channel to query (ISYS_OUTPUT_1, ISYS_OUTPUT_2, or ISYS_OUTPUT_3)
+ *
+ * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
+ *         - ERR_NULL_POINTER: pTargetList is NULL
+ *         - ERR_OUTPUT_OUT_OF_RANGE: Invalid output channel number
+ *         - ERR_PARAMETER_OUT_OF_RANGE: Bus is full, address already registered or broadcast address 0x00
+ *         - ERR_TRANSACTION_BUSY: The scheduler is running
+ *
+ * @example
+ *   static iSYSTargetList_t frontList;
+ *   bus.addDevice(0x80, &frontList, ISYS_OUTPUT_1);
+ */
+iSYSResult_t iSYS4001Bus::addDevice(uint8_t address, iSYSTargetList_t *pTargetList, iSYSOutputNumber_t outputnumber)
+{
+    if (pTargetList == NULL)
+        return ERR_NULL_POINTER;
+
+    if (outputnumber < ISYS_OUTPUT_1 || outputnumber > ISYS_OUTPUT_3)
+    {
+        return ERR_OUTPUT_OUT_OF_RANGE;
+    }
+
+    if (_running || _busy)
+    {
+        return ERR_TRANSACTION_BUSY;
+    }
+
+    // Responses are matched by source address, so every device needs its own
+    if (_deviceCount >= ISYS_BUS_MAX_DEVICES || address == 0x00)
+    {
+        return ERR_PARAMETER_OUT_OF_RANGE;
+    }
+
+    for (uint8_t i = 0; i < _deviceCount; i++)
+    {
+        if (_devices[i].stats.address == address)
+        {
+            return ERR_PARAMETER_OUT_OF_RANGE;
+        }
+    }
+
+    iSYSBusDevice_t *device = &_devices[_deviceCount++];
+    memset(device, 0, sizeof(iSYSBusDevice_t));
+    device->targetList = pTargetList;
+    device->outputnumber = outputnumber;
+    device->stats.address = address;
+    device->stats.online = true;
+    device->stats.lastResult = ERR_OK;
+
+    return ERR_OK;
+}
+
+/**
+ * @brief Select the target list format requested from all devices
+ *
+ * @param bitrate 16 for the compact 16-bit format, 32 for the high-precision 32-bit format
+ *
+ * @return iSYSResult_t ERR_OK on success, or ERR_PARAMETER_OUT_OF_RANGE for any other value
+ *
+ * @note 16-bit lists need half the wire time, which matters when several sensors share the line.
+ */
+iSYSResult_t iSYS4001Bus::setBitrate(uint8_t bitrate)
+{
+    if (bitrate != 16 && bitrate != 32)
+    {
+        return ERR_PARAMETER_OUT_OF_RANGE;
+    }
+
+    _bitrate = bitrate;
+    return ERR_OK;
+}
+
+/**
+ * @brief Set the response timeouts
+ *
+ * @param timeout Maximum time in milliseconds to wait for an online device
+ * @param probeTimeout Maximum time in milliseconds to wait when probing an offline device
+ *
+ * @return iSYSResult_t ERR_OK on success, or ERR_TIMEOUT if either value is 0
+ *
+ * @note Recommended timeout is >= 100ms; the probe timeout only needs to cover one
+ *       response, not a retry budget.
+ */
+iSYSResult_t iSYS4001Bus::setTimeouts(uint32_t timeout, uint32_t probeTimeout)
+{
+    if (timeout == 0 || probeTimeout == 0)
+    {
+        return ERR_TIMEOUT;
+    }
+
+    _timeout = timeout;
+    _probeTimeout = probeTimeout;
+    return ERR_OK;
+}
+
+/**
+ * @brief Configure when a device is considered offline and how often it is probed
+ *
+ * @param offlineThreshold Consecutive failures after which a device is marked offline (>= 1)
+ * @param probeInterval Number of rounds an offline device is skipped between probes
+ *
+ * @return iSYSResult_t ERR_OK on success, or ERR_PARAMETER_OUT_OF_RANGE if offlineThreshold is 0
+ *
+ * @example
+ *   // Offline after 2 misses, probe every 20 rounds
+ *   bus.setOfflinePolicy(2, 20);
+ */
+iSYSResult_t iSYS4001Bus::setOfflinePolicy(uint8_t offlineThreshold, uint8_t probeInterval)
+{
+    if (offlineThreshold == 0)
+    {
+        return ERR_PARAMETER_OUT_OF_RANGE;
+    }
+
+    _offlineThreshold = offlineThreshold;
+    _probeInterval = probeInterval;
+    return ERR_OK;
+}
+
+/***************************************************************
+ *  SCHEDULER FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Start round-robin target list acquisition
+ *
+ * Switches the driver to non-blocking mode and sends the first request.
+ *
+ * @return iSYSResult_t ERR_OK on success, or error code for failure conditions:
+ *         - ERR_PARAMETER_OUT_OF_RANGE: No device registered
+ *         - ERR_TRANSACTION_BUSY: A request from before stop() is still in flight
+ *
+ * @note Acquisition must already be started on every sensor (iSYS_startAcquisition()).
+ */
+iSYSResult_t iSYS4001Bus::start()
+{
+    if (_deviceCount == 0)
+    {
+        return ERR_PARAMETER_OUT_OF_RANGE;
+    }
+
+    if (_busy)
+    {
+        return ERR_TRANSACTION_BUSY;
+    }
+
+    iSYSResult_t res = _radar.setNonBlocking(true);
+    if (res != ERR_OK)
+    {
+        return res;
+    }
+
+    _running = true;
+    startNextRequest();
+    return ERR_OK;
+}
+
+/**
+ * @brief Stop round-robin acquisition
+ *
+ * No new requests are sent. A request already in flight is completed by later
+ * poll() calls; once isRunning() returns false the driver is back in blocking
+ * mode and getRadar() can be used for configuration.
+ *
+ * @return iSYSResult_t ERR_OK
+ */
+iSYSResult_t iSYS4001Bus::stop()
+{
+    _running = false;
+
+    if (!_busy)
+    {
+        _radar.setNonBlocking(false);
+    }
+
+    return ERR_OK;
+}
+
+/**
+ * @brief Advance the scheduler
+ *
+ * Collects the response for the request in flight and, once it is complete,
+ * updates that device's statistics and immediately sends the request for the
+ * next device. Never waits for data.
+ *
+ * @param deviceIndex Set to the index (registration order) of the device whose
+ *        request just completed; may be NULL
+ *
+ * @return bool true if a request completed in this call (check getDeviceStats()->lastResult
+ *         to see whether the device's target list was refreshed), false otherwise
+ *
+ * @example
+ *   uint8_t device;
+ *   if (bus.poll(&device)) {
+ *       const iSYSBusDeviceStats_t *stats = bus.getDeviceStats(device);
+ *       if (stats->lastResult == ERR_OK) {
+ *           // lists[device] holds a new target list
+ *       }
+ *   }
+ */
+bool iSYS4001Bus::poll(uint8_t *deviceIndex)
+{
+    if (!_busy)
+    {
+        if (_running)
+        {
+            startNextRequest();
+        }
+        return false;
+    }
+
+    if (_radar.poll() != ISYS_TRANSACTION_COMPLETE)
+    {
+        return false;
+    }
+
+    _busy = false;
+    recordResult(&_devices[_current], _radar.getTransactionResult());
+
+    if (deviceIndex != NULL)
+    {
+        *deviceIndex = _current;
+    }
+
+    _current = (_current + 1) % _deviceCount;
+
+    if (_running)
+    {
+        startNextRequest();
+    }
+    else
+    {
+        _radar.setNonBlocking(false);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Check whether the scheduler is running or still finishing a request
+ *
+ * @return bool true while started or while a request sent before stop() is in flight
+ */
+bool iSYS4001Bus::isRunning()
+{
+    return _running || _busy;
+}
+
+/***************************************************************
+ *  STATUS FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Get the number of registered devices
+ *
+ * @return uint8_t Number of devices added with addDevice()
+ */
+uint8_t iSYS4001Bus::getDeviceCount()
+{
+    return _deviceCount;
+}
+
+/**
+ * @brief Get the statistics of a registered device
+ *
+ * @param index Device index in registration order (0 to getDeviceCount() - 1)
+ *
+ * @return const iSYSBusDeviceStats_t* Pointer to the device statistics, or NULL for an invalid index
+ *
+ * @example
+ *   const iSYSBusDeviceStats_t *stats = bus.getDeviceStats(0);
+ *   Serial.printf("0x%02X %s %lu/%lu\n", stats->address, stats->online ? "online" : "offline",
+ *                 stats->responses, stats->requests);
+ */
+const iSYSBusDeviceStats_t *iSYS4001Bus::getDeviceStats(uint8_t index)
+{
+    if (index >= _deviceCount)
+    {
+        return NULL;
+    }
+
+    return &_devices[index].stats;
+}
+
+/**
+ * @brief Access the underlying driver
+ *
+ * @return iSYS4001& Driver that owns the serial port
+ *
+ * @note Use it for configuration (filters, acquisition start/stop, EEPROM) only while
+ *       isRunning() is false; while running every call returns ERR_TRANSACTION_BUSY.
+ *
+ * @example
+ *   bus.getRadar().iSYS_startAcquisition(0x81, 300);
+ */
+iSYS4001 &iSYS4001Bus::getRadar()
+{
+    return _radar;
+}
+
+/***************************************************************
+ *  HELPER FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Internal function to apply the scheduler defaults
+ */
+void iSYS4001Bus::init()
+{
+    memset(_devices, 0, sizeof(_devices));
+    _deviceCount = 0;
+    _current = 0;
+    _running = false;
+    _busy = false;
+    _bitrate = 16;
+    _timeout = 300;
+    _probeTimeout = 100;
+    _offlineThreshold = 3;
+    _probeInterval = 10;
+}
+
+/**
+ * @brief Internal function to send the target list request for the next due device
+ *
+ * Starting at _current, skips offline devices whose probe is not yet due and sends
+ * the request to the first device that is. Offline devices are probed with the
+ * shorter probe timeout.
+ */
+void iSYS4001Bus::startNextRequest()
+{
+    for (uint8_t tries = 0; tries < _deviceCount; tries++)
+    {
+        iSYSBusDevice_t *device = &_devices[_current];
+
+        if (!device->stats.online && device->skipRounds > 0)
+        {
+            device->skipRounds--;
+            _current = (_current + 1) % _deviceCount;
+            continue;
+        }
+
+        uint32_t timeout = device->stats.online ? _timeout : _probeTimeout;
+        iSYSResult_t res;
+
+        if (_bitrate == 32)
+            res = _radar.getTargetList32(device->targetList, device->stats.address, timeout, device->outputnumber);
+        else
+            res = _radar.getTargetList16(device->targetList, device->stats.address, timeout, device->outputnumber);
+
+        device->stats.requests++;
+        device->requestTime = _radar.getTransport().millis();
+
+        if (res == ERR_TRANSACTION_PENDING)
+        {
+            _busy = true;
+            return;
+        }
+
+        // The request could not be sent; count it and move on
+        recordResult(device, res);
+        _current = (_current + 1) % _deviceCount;
+    }
+}
+
+/**
+ * @brief Internal function to update a device's statistics after a request
+ *
+ * @param device Device whose request finished
+ * @param result Result of the request
+ */
+void iSYS4001Bus::recordResult(iSYSBusDevice_t *device, iSYSResult_t result)
+{
+    iSYSBusDeviceStats_t *stats = &device->stats;
+    stats->lastResult = result;
+
+    if (result == ERR_OK)
+    {
+        stats->responses++;
+        stats->consecutiveFailures = 0;
+        stats->online = true;
+        stats->lastResponseTime = _radar.getTransport().millis();
+        stats->lastLatency = stats->lastResponseTime - device->requestTime;
+        device->skipRounds = 0;
+        return;
+    }
+
+    if (result == ERR_COMMAND_NO_DATA_RECEIVED || result == ERR_COMMAND_RX_FRAME_LENGTH || result == ERR_FRAME_INCOMPLETE)
+        stats->timeouts++;
+    else
+        stats->errors++;
+
+    if (stats->consecutiveFailures < 0xFF)
+    {
+        stats->consecutiveFailures++;
+    }
+
+    if (stats->consecutiveFailures >= _offlineThreshold)
+    {
+        stats->online = false;
+        device->skipRounds = _probeInterval;
+    }
+}
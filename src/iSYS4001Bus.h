@@ -0,0 +1,117 @@
+#ifndef ISYS4001BUS_H
+#define ISYS4001BUS_H
+
+#include "iSYS4001.h"
+
+// Maximum number of sensors one bus scheduler can serve
+#define ISYS_BUS_MAX_DEVICES (8)
+
+/**
+ * @brief Per-device statistics kept by the bus scheduler
+ *
+ * All counters start at zero when the device is added and wrap on overflow.
+ */
+typedef struct iSYSBusDeviceStats
+{
+    uint8_t address;             // device address on the bus
+    bool online;                 // false after offlineThreshold consecutive failures
+    uint32_t requests;           // target list requests sent
+    uint32_t responses;          // requests answered with a valid target list
+    uint32_t timeouts;           // requests that received no usable response
+    uint32_t errors;             // requests answered with a damaged or invalid frame
+    uint8_t consecutiveFailures; // failures since the last valid response
+    uint32_t lastLatency;        // ms from request to response of the last valid response
+    uint32_t lastResponseTime;   // millis() timestamp of the last valid response
+    iSYSResult_t lastResult;     // result of the most recent request
+} iSYSBusDeviceStats_t;
+
+/**
+ * @brief Round-robin scheduler for several iSYS sensors sharing one UART
+ *
+ * Owns the serial port and requests target lists from every registered device in
+ * turn. The next request goes out in the same poll() that completes the previous
+ * one, so the line is never idle between devices. A device that fails
+ * offlineThreshold times in a row is marked offline and afterwards only probed
+ * every probeInterval rounds with the shorter probe timeout, so a dead sensor
+ * no longer costs the full timeout on every round.
+ *
+ * @note The scheduler runs the underlying iSYS4001 in non-blocking mode while it is
+ *       running. Configure the sensors through getRadar() before start() or after stop().
+ *
+ * @example
+ *   iSYS4001Bus bus(Serial2, 115200);
+ *   static iSYSTargetList_t lists[2];
+ *   bus.addDevice(0x80, &lists[0]);
+ *   bus.addDevice(0x81, &lists[1]);
+ *   bus.start();
+ *   void loop() {
+ *       uint8_t device;
+ *       if (bus.poll(&device) && bus.getDeviceStats(device)->lastResult == ERR_OK) {
+ *           Serial.println(lists[device].nrOfTargets);
+ *       }
+ *   }
+ */
+class iSYS4001Bus
+{
+
+public:
+#if defined(ARDUINO)
+    iSYS4001Bus(HardwareSerial &serial, uint32_t baud = 115200);
+#endif
+    iSYS4001Bus(iSYSTransport &transport);
+
+    /***************************************************************
+     *  CONFIGURATION FUNCTIONS
+     ***************************************************************/
+    iSYSResult_t addDevice(uint8_t address, iSYSTargetList_t *pTargetList, iSYSOutputNumber_t outputnumber = ISYS_OUTPUT_1);
+    iSYSResult_t setBitrate(uint8_t bitrate);
+    iSYSResult_t setTimeouts(uint32_t timeout, uint32_t probeTimeout);
+    iSYSResult_t setOfflinePolicy(uint8_t offlineThreshold, uint8_t probeInterval);
+
+    /***************************************************************
+     *  SCHEDULER FUNCTIONS
+     ***************************************************************/
+    iSYSResult_t start();
+    iSYSResult_t stop();
+    bool poll(uint8_t *deviceIndex);
+    bool isRunning();
+
+    /***************************************************************
+     *  STATUS FUNCTIONS
+     ***************************************************************/
+    uint8_t getDeviceCount();
+    const iSYSBusDeviceStats_t *getDeviceStats(uint8_t index);
+    iSYS4001 &getRadar();
+
+private:
+    typedef struct
+    {
+        iSYSTargetList_t *targetList;
+        iSYSOutputNumber_t outputnumber;
+        uint8_t skipRounds; // rounds left before an offline device is probed again
+        uint32_t requestTime;
+        iSYSBusDeviceStats_t stats;
+    } iSYSBusDevice_t;
+
+    iSYS4001 _radar;
+    iSYSBusDevice_t _devices[ISYS_BUS_MAX_DEVICES];
+    uint8_t _deviceCount;
+    uint8_t _current; // device whose request is in flight (or next to be served)
+    bool _running;
+    bool _busy; // a request is in flight
+
+    uint8_t _bitrate;
+    uint32_t _timeout;
+    uint32_t _probeTimeout;
+    uint8_t _offlineThreshold;
+    uint8_t _probeInterval;
+
+    /***************************************************************
+     *  HELPER FUNCTIONS
+     ***************************************************************/
+    void init();
+    void startNextRequest();
+    void recordResult(iSYSBusDevice_t *device, iSYSResult_t result);
+};
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef ISYSCAPTURE_H
+#define ISYSCAPTURE_H
+
+#include <stdint.h>
+
+/*
+ * Binary capture format for raw iSYS traffic (see iSYS4001::setCapture())
+ *
+ * A capture starts with an 8 byte file header followed by one record per frame.
+ * All multi-byte fields are little endian.
+ *
+ *   File header:  'i' 'S' 'Y' 'S' 'C' 'A' 'P' version
+ *   Record:       timestamp (4) | direction (1) | address (1) | length (2) | frame bytes (length)
+ *
+ * timestamp is the transport's micros() clock when the frame was sent or completed.
+ * It wraps every 71.6 minutes; readers unwrap it by treating every step between
+ * consecutive records as a forward step. address is the destination address of
+ * TX frames and the source address of RX frames.
+ */
+
+#define ISYS_CAPTURE_VERSION (1)
+#define ISYS_CAPTURE_FILE_HEADER_LENGTH (8)
+#define ISYS_CAPTURE_RECORD_HEADER_LENGTH (8)
+
+/**
+ * @brief Direction of a captured frame
+ */
+typedef enum iSYSCaptureDirection
+{
+    ISYS_CAPTURE_TX = 0,        // request sent by the driver
+    ISYS_CAPTURE_RX = 1,        // complete frame received from the bus
+    ISYS_CAPTURE_RX_PARTIAL = 2 // bytes left in the receive buffer when a transaction timed out
+} iSYSCaptureDirection_t;
+
+/**
+ * @brief Decoded capture record header
+ */
+typedef struct iSYSCaptureRecord
+{
+    uint32_t timestamp; // µs, transport micros() clock
+    uint8_t direction;  // iSYSCaptureDirection_t
+    uint8_t address;    // destination (TX) or source (RX) address
+    uint16_t length;    // number of frame bytes following the header
+} iSYSCaptureRecord_t;
+
+#endif
@@ -0,0 +1,424 @@
+#include "iSYSFrameParser.h"
+
+/**
+ * @brief Constructor for the iSYS frame parser
+ *
+ * @param buffer Caller-owned storage the frames are assembled in
+ * @param capacity Size of buffer in bytes; frames longer than this are treated as invalid
+ *
+ * @note Size the buffer for the largest frame expected (ISYS_MAX_FRAME_LENGTH for iSYS4001).
+ *
+ * @example
+ *   static uint8_t buffer[ISYS_MAX_FRAME_LENGTH];
+ *   iSYSFrameParser parser(buffer, sizeof(buffer));
+ */
+iSYSFrameParser::iSYSFrameParser(uint8_t *buffer, uint16_t capacity)
+    : _buffer(buffer), _capacity(capacity), _start(0), _length(0), _frameLength(0), _discarded(0),
+      _fcsOffset(0), _fcs(0), _fcsValid(false)
+{
+}
+
+/**
+ * @brief Drop all buffered bytes and any ready frame
+ *
+ * @note The discarded byte counter is not cleared.
+ */
+void iSYSFrameParser::reset()
+{
+    _start = 0;
+    _length = 0;
+    _frameLength = 0;
+    _fcsOffset = 0;
+    _fcs = 0;
+}
+
+/***************************************************************
+ *  INPUT FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Feed one received byte into the parser
+ *
+ * @param data Byte read from the UART
+ *
+ * @return bool true if a complete frame is now available through frame(), false otherwise
+ *
+ * @note While a frame is ready, further bytes are buffered behind it and examined after
+ *       releaseFrame(). If the buffer is full the byte is dropped and counted as discarded.
+ */
+bool iSYSFrameParser::push(uint8_t data)
+{
+    if (_length == _capacity)
+    {
+        compact();
+        if (_length == _capacity)
+        {
+            _discarded++;
+            return (_frameLength != 0);
+        }
+    }
+
+    _buffer[_length++] = data;
+
+    if (_frameLength != 0)
+    {
+        return true;
+    }
+
+    return scan();
+}
+
+/**
+ * @brief Feed a block of received bytes into the parser
+ *
+ * Consumes bytes until a complete frame is available or the block is exhausted.
+ *
+ * @param data Pointer to the received bytes
+ * @param length Number of bytes in data
+ *
+ * @return uint16_t Number of bytes consumed; if this is less than length, a frame is
+ *         ready and the remaining bytes should be pushed after releaseFrame()
+ */
+uint16_t iSYSFrameParser::push(const uint8_t *data, uint16_t length)
+{
+    uint16_t consumed = 0;
+
+    while (consumed < length && _frameLength == 0)
+    {
+        push(data[consumed++]);
+    }
+
+    return consumed;
+}
+
+/**
+ * @brief Get the free space behind the buffered data for a bulk read
+ *
+ * Lets the caller read a block from the UART directly into the frame buffer
+ * (e.g. with Stream::readBytes()) and hand it over with commit(), avoiding a
+ * driver call and a copy per byte.
+ *
+ * @param space Set to the number of bytes that may be written to the returned pointer
+ *
+ * @return uint8_t* Pointer to the first free byte; only valid until the next call
+ *         to push(), commit(), releaseFrame() or reset()
+ *
+ * @example
+ *   uint16_t space;
+ *   uint8_t *dest = parser.writeBuffer(&space);
+ *   uint16_t count = Serial2.readBytes(dest, min(space, (uint16_t)Serial2.available()));
+ *   if (parser.commit(count)) {
+ *       handleFrame(parser.frame(), parser.frameLength());
+ *   }
+ */
+uint8_t *iSYSFrameParser::writeBuffer(uint16_t *space)
+{
+    compact();
+
+    // Only a complete frame can fill the whole buffer; anything else is a stale candidate
+    if (_length == _capacity && _frameLength == 0)
+    {
+        _discarded += _length;
+        reset();
+    }
+
+    *space = _capacity - _length;
+    return &_buffer[_length];
+}
+
+/**
+ * @brief Hand over bytes written to writeBuffer()
+ *
+ * @param count Number of bytes written (at most the space reported by writeBuffer())
+ *
+ * @return bool true if a complete frame is now available through frame(), false otherwise
+ *
+ * @note Bytes following a complete frame stay buffered and are examined after releaseFrame().
+ */
+bool iSYSFrameParser::commit(uint16_t count)
+{
+    if (count > _capacity - _length)
+    {
+        count = _capacity - _length;
+    }
+    _length += count;
+
+    if (_frameLength != 0)
+    {
+        return true;
+    }
+
+    return scan();
+}
+
+/***************************************************************
+ *  FRAME ACCESS FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Check whether a complete frame is available
+ *
+ * @return bool true if frame() and frameLength() describe a complete frame
+ */
+bool iSYSFrameParser::frameReady() const
+{
+    return (_frameLength != 0);
+}
+
+/**
+ * @brief Get the ready frame
+ *
+ * @return const uint8_t* Pointer to the first byte (start delimiter) of the frame;
+ *         only valid until releaseFrame(), push() or reset() is called
+ */
+const uint8_t *iSYSFrameParser::frame() const
+{
+    return &_buffer[_start];
+}
+
+/**
+ * @brief Get the length of the ready frame
+ *
+ * @return uint16_t Frame length in bytes including delimiters, 0 if no frame is ready
+ */
+uint16_t iSYSFrameParser::frameLength() const
+{
+    return _frameLength;
+}
+
+/**
+ * @brief Check the FCS of the ready frame
+ *
+ * @return bool true if the FCS byte matches the sum of the frame bytes it covers,
+ *         false if it does not or no frame is ready
+ *
+ * @note The sum is accumulated while the frame is received; calling this is free.
+ */
+bool iSYSFrameParser::frameChecksumValid() const
+{
+    return (_frameLength != 0) && _fcsValid;
+}
+
+/**
+ * @brief Release the ready frame and continue with the bytes buffered behind it
+ *
+ * @return bool true if the bytes buffered behind the released frame already form
+ *         another complete frame, false otherwise
+ */
+bool iSYSFrameParser::releaseFrame()
+{
+    if (_frameLength == 0)
+    {
+        return false;
+    }
+
+    _start += _frameLength;
+    _frameLength = 0;
+    _fcsOffset = 0;
+    _fcs = 0;
+
+    if (_start == _length)
+    {
+        _start = 0;
+        _length = 0;
+        return false;
+    }
+
+    return scan();
+}
+
+/**
+ * @brief Compute the FCS of a complete frame
+ *
+ * Sums the bytes the FCS covers: DA up to the last payload byte, i.e. from index 4
+ * in SD2 frames and from index 1 in 32-bit long frames.
+ *
+ * @param frame Complete frame from the start delimiter to the end delimiter
+ * @param length Number of bytes in the frame
+ *
+ * @return uint8_t Expected value of frame[length - 2]; 0 if the frame is too short to carry an FCS
+ *
+ * @note For frames that did not pass through a parser, e.g. ones read back from a capture.
+ */
+uint8_t iSYSFrameParser::checksum(const uint8_t *frame, uint16_t length)
+{
+    uint8_t fcs = 0;
+
+    for (uint16_t i = (frame[0] == ISYS_FRAME_SD2) ? 4 : 1; i + 2 < length; i++)
+    {
+        fcs += frame[i];
+    }
+
+    return fcs;
+}
+
+/***************************************************************
+ *  STATUS FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Get the number of bytes buffered for the frame currently being received
+ *
+ * @return uint16_t Buffered bytes (including a ready frame), 0 if the parser is idle
+ */
+uint16_t iSYSFrameParser::bufferedLength() const
+{
+    return _length - _start;
+}
+
+/**
+ * @brief Get the number of bytes skipped while searching for a valid frame start
+ *
+ * @return uint32_t Total bytes discarded since construction
+ */
+uint32_t iSYSFrameParser::discardedBytes() const
+{
+    return _discarded;
+}
+
+/***************************************************************
+ *  HELPER FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Internal function to move the current candidate to the front of the buffer
+ *
+ * @note Keeps the end of the buffer free for new bytes; a ready frame moves with it.
+ */
+void iSYSFrameParser::compact()
+{
+    if (_start == 0)
+    {
+        return;
+    }
+
+    memmove(_buffer, &_buffer[_start], _length - _start);
+    _length -= _start;
+    _start = 0;
+}
+
+/**
+ * @brief Internal function to advance to the next valid frame candidate
+ *
+ * Drops leading bytes one at a time until the buffered data starts with a candidate
+ * that is either still plausible or a complete frame.
+ *
+ * @return bool true if a complete frame starts at the front of the buffered data
+ */
+bool iSYSFrameParser::scan()
+{
+    while (_start < _length)
+    {
+        uint16_t expectedLength = 0;
+        iSYSCandidate_t candidate = checkCandidate(&expectedLength);
+
+        if (candidate == ISYS_CANDIDATE_COMPLETE)
+        {
+            accumulateChecksum(expectedLength);
+            _fcsValid = (_fcs == _buffer[_start + expectedLength - 2]);
+            _frameLength = expectedLength;
+            return true;
+        }
+
+        if (candidate == ISYS_CANDIDATE_INCOMPLETE)
+        {
+            if (expectedLength != 0)
+            {
+                accumulateChecksum(expectedLength);
+            }
+            return false;
+        }
+
+        _start++;
+        _discarded++;
+        _fcsOffset = 0;
+        _fcs = 0;
+    }
+
+    _start = 0;
+    _length = 0;
+    return false;
+}
+
+/**
+ * @brief Internal function to add newly buffered candidate bytes to the running FCS
+ *
+ * Only bytes not yet summed are added, so every byte of a frame is summed exactly once
+ * no matter how the stream was split into push() and commit() calls.
+ *
+ * @param expectedLength Complete frame length taken from the candidate header
+ */
+void iSYSFrameParser::accumulateChecksum(uint16_t expectedLength)
+{
+    const uint8_t *candidate = &_buffer[_start];
+    const uint16_t available = _length - _start;
+    const uint16_t end = (available < expectedLength - 2) ? available : (uint16_t)(expectedLength - 2);
+    uint16_t offset = _fcsOffset;
+    uint8_t fcs = _fcs;
+
+    if (offset == 0)
+    {
+        // SD2 frames sum from DA (index 4), long frames from DA (index 1)
+        offset = (candidate[0] == ISYS_FRAME_SD2) ? 4 : 1;
+    }
+
+    while (offset < end)
+    {
+        fcs += candidate[offset++];
+    }
+
+    _fcsOffset = offset;
+    _fcs = fcs;
+}
+
+/**
+ * @brief Internal function to check the buffered data against the iSYS frame layouts
+ *
+ * @param expectedLength Set to the complete frame length once it is known from the header
+ *
+ * @return iSYSCandidate_t ISYS_CANDIDATE_INVALID, ISYS_CANDIDATE_INCOMPLETE or ISYS_CANDIDATE_COMPLETE
+ */
+iSYSFrameParser::iSYSCandidate_t iSYSFrameParser::checkCandidate(uint16_t *expectedLength) const
+{
+    const uint8_t *candidate = &_buffer[_start];
+    const uint16_t available = _length - _start;
+
+    if (candidate[0] == ISYS_FRAME_SD2)
+    {
+        // SD2: 0x68 LE LEr 0x68 ... FCS 0x16, LE counts DA SA FC and payload
+        if (available >= 2 && candidate[1] < 3)
+            return ISYS_CANDIDATE_INVALID;
+        if (available >= 3 && candidate[2] != candidate[1])
+            return ISYS_CANDIDATE_INVALID;
+        if (available >= 4 && candidate[3] != ISYS_FRAME_SD2)
+            return ISYS_CANDIDATE_INVALID;
+        if (available < 4)
+            return ISYS_CANDIDATE_INCOMPLETE;
+
+        *expectedLength = (uint16_t)candidate[1] + 6;
+    }
+    else
+    {
+        // Long frame: SD DA SA 0xDA output nrOfTargets ..., only sent as a response to the master
+        if (available >= 2 && candidate[1] != ISYS_FRAME_MASTER_ADDRESS)
+            return ISYS_CANDIDATE_INVALID;
+        if (available >= 4 && candidate[3] != ISYS_FRAME_FC_TARGET_LIST)
+            return ISYS_CANDIDATE_INVALID;
+        if (available < ISYS_LONG_FRAME_HEADER_LENGTH)
+            return ISYS_CANDIDATE_INCOMPLETE;
+
+        // A clipping frame (0xFF) carries no target records
+        const uint8_t nrOfTargets = candidate[ISYS_LONG_FRAME_HEADER_LENGTH - 1];
+        const uint16_t nrOfRecords = (nrOfTargets == 0xFF) ? 0 : nrOfTargets;
+        *expectedLength = ISYS_LONG_FRAME_HEADER_LENGTH + (ISYS_LONG_FRAME_BYTES_PER_TARGET * nrOfRecords) + 2;
+    }
+
+    if (*expectedLength > _capacity)
+        return ISYS_CANDIDATE_INVALID;
+    if (available < *expectedLength)
+        return ISYS_CANDIDATE_INCOMPLETE;
+    if (candidate[*expectedLength - 1] != ISYS_FRAME_END)
+        return ISYS_CANDIDATE_INVALID;
+
+    return ISYS_CANDIDATE_COMPLETE;
+}
@@ -0,0 +1,109 @@
+#ifndef ISYSFRAMEPARSER_H
+#define ISYSFRAMEPARSER_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Frame delimiters and fixed fields of the iSYS protocol
+#define ISYS_FRAME_SD2 (0x68)            // start delimiter of variable length frames
+#define ISYS_FRAME_END (0x16)            // end delimiter of every frame
+#define ISYS_FRAME_MASTER_ADDRESS (0x01) // destination address of every sensor response
+#define ISYS_FRAME_FC_TARGET_LIST (0xDA) // function code of target list frames
+
+// Layout of the 32-bit target list long frame: [SD, DA, SA, FC, output, nrOfTargets, 14 bytes per target..., FCS, END]
+#define ISYS_LONG_FRAME_HEADER_LENGTH (6)
+#define ISYS_LONG_FRAME_BYTES_PER_TARGET (14)
+
+/**
+ * @brief Incremental parser for the iSYS byte stream
+ *
+ * Collects bytes from the UART one at a time or in chunks and reports when a
+ * complete frame has been received. Two frame layouts are recognised:
+ *   - SD2 frames: 0x68 LE LEr 0x68 DA SA FC payload FCS 0x16, length taken from LE
+ *   - 32-bit target list long frames: SD DA SA 0xDA output nrOfTargets data FCS 0x16,
+ *     length taken from the target count
+ *
+ * The frame length is always derived from the header, so a payload or FCS byte
+ * equal to 0x16 never ends a frame early. A candidate whose header fields or end
+ * delimiter do not match is dropped one byte at a time until the next valid start
+ * is found, so garbage or a partial earlier response only costs the bytes involved.
+ *
+ * The FCS is summed while bytes arrive, so checking it costs no second pass over
+ * the frame; frameChecksumValid() reports the result for the ready frame.
+ *
+ * @note The parser validates frame structure only. A frame with a wrong FCS is still
+ *       returned so the consumer can report it; addresses, function codes and the
+ *       FCS result are acted on by the code that consumes the frame.
+ * @note The buffer is owned by the caller; the parser never allocates memory.
+ *
+ * @note For bulk UART reads, read directly into writeBuffer() and call commit() instead
+ *       of pushing byte by byte.
+ *
+ * @example
+ *   uint8_t buffer[ISYS_MAX_FRAME_LENGTH];
+ *   iSYSFrameParser parser(buffer, sizeof(buffer));
+ *   while (Serial2.available()) {
+ *       if (parser.push((uint8_t)Serial2.read())) {
+ *           handleFrame(parser.frame(), parser.frameLength());
+ *           parser.releaseFrame();
+ *       }
+ *   }
+ */
+class iSYSFrameParser
+{
+
+public:
+    iSYSFrameParser(uint8_t *buffer, uint16_t capacity);
+
+    void reset();
+
+    /***************************************************************
+     *  INPUT FUNCTIONS
+     ***************************************************************/
+    bool push(uint8_t data);
+    uint16_t push(const uint8_t *data, uint16_t length);
+    uint8_t *writeBuffer(uint16_t *space);
+    bool commit(uint16_t count);
+
+    /***************************************************************
+     *  FRAME ACCESS FUNCTIONS
+     ***************************************************************/
+    bool frameReady() const;
+    const uint8_t *frame() const;
+    uint16_t frameLength() const;
+    bool frameChecksumValid() const;
+    bool releaseFrame();
+
+    static uint8_t checksum(const uint8_t *frame, uint16_t length);
+
+    /***************************************************************
+     *  STATUS FUNCTIONS
+     ***************************************************************/
+    uint16_t bufferedLength() const;
+    uint32_t discardedBytes() const;
+
+private:
+    typedef enum
+    {
+        ISYS_CANDIDATE_INVALID = 0, // header or end delimiter mismatch
+        ISYS_CANDIDATE_INCOMPLETE,  // plausible so far, more bytes needed
+        ISYS_CANDIDATE_COMPLETE     // complete frame at the start of the buffer
+    } iSYSCandidate_t;
+
+    uint8_t *_buffer;
+    uint16_t _capacity;
+    uint16_t _start;       // offset of the current candidate in _buffer
+    uint16_t _length;      // end of buffered data in _buffer
+    uint16_t _frameLength; // length of the ready frame, 0 if none
+    uint32_t _discarded;
+    uint16_t _fcsOffset; // offset of the next candidate byte to add to _fcs, 0 before the first
+    uint8_t _fcs;        // running FCS of the current candidate
+    bool _fcsValid;      // FCS result of the ready frame
+
+    void compact();
+    bool scan();
+    void accumulateChecksum(uint16_t expectedLength);
+    iSYSCandidate_t checkCandidate(uint16_t *expectedLength) const;
+};
+
+#endif
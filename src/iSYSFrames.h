@@ -0,0 +1,89 @@
+#ifndef ISYSFRAMES_H
+#define ISYSFRAMES_H
+
+#include <stdint.h>
+
+#include "iSYSFrameParser.h"
+
+/*
+ * Compile-time request frames
+ *
+ * Requests without a run-time value (acquisition start/stop, the EEPROM commands,
+ * target list requests for a fixed output and format) are fully determined once the
+ * device address is known. iSYSFrame builds such an SD2 frame, FCS included, as a
+ * constant array while compiling, so sending it is a single write of read-only data:
+ *
+ *   0x68 LE LE 0x68 DA 0x01 FC data... FCS 0x16
+ *
+ * The driver uses these frames for requests to ISYS_PRECOMPUTED_ADDRESS and builds
+ * frames for any other address at run time. Applications with a different fixed
+ * address can move the fast path to it by defining ISYS_PRECOMPUTED_ADDRESS for the
+ * whole build (e.g. build_flags = -DISYS_PRECOMPUTED_ADDRESS=0x81).
+ *
+ * @note The arrays are const and end up in flash on ARM and ESP32 targets. AVR keeps
+ *       const data in SRAM unless it is declared PROGMEM, which UART writes cannot read
+ *       directly; there the frames cost 128 bytes of SRAM.
+ *
+ * @example
+ *   // Start acquisition on a sensor at address 0x81
+ *   typedef iSYSAcquisitionFrame<0x81, true> StartFrame;
+ *   Serial2.write(StartFrame::bytes, StartFrame::length);
+ */
+
+// Device address the driver precomputes its fixed request frames for
+#ifndef ISYS_PRECOMPUTED_ADDRESS
+#define ISYS_PRECOMPUTED_ADDRESS (0x80)
+#endif
+
+/**
+ * @brief FCS of a sequence of bytes, evaluated by the compiler for constant arguments
+ *
+ * @return uint8_t Sum of all arguments modulo 256
+ */
+constexpr uint8_t iSYSFrameChecksum()
+{
+    return 0;
+}
+
+template <typename... Bytes>
+constexpr uint8_t iSYSFrameChecksum(uint8_t first, Bytes... rest)
+{
+    return (uint8_t)(first + iSYSFrameChecksum(rest...));
+}
+
+/**
+ * @brief Constant SD2 request frame
+ *
+ * @tparam DestAddress Device address (DA)
+ * @tparam FunctionCode Function code (FC)
+ * @tparam Data Payload bytes following the function code
+ */
+template <uint8_t DestAddress, uint8_t FunctionCode, uint8_t... Data>
+struct iSYSFrame
+{
+    static const uint8_t length = sizeof...(Data) + 9;
+    static const uint8_t bytes[sizeof...(Data) + 9];
+};
+
+template <uint8_t DestAddress, uint8_t FunctionCode, uint8_t... Data>
+const uint8_t iSYSFrame<DestAddress, FunctionCode, Data...>::bytes[sizeof...(Data) + 9] = {
+    ISYS_FRAME_SD2, sizeof...(Data) + 3, sizeof...(Data) + 3, ISYS_FRAME_SD2,
+    DestAddress, ISYS_FRAME_MASTER_ADDRESS, FunctionCode, Data...,
+    iSYSFrameChecksum(DestAddress, ISYS_FRAME_MASTER_ADDRESS, FunctionCode, Data...), ISYS_FRAME_END};
+
+// Acquisition start (0xD1 0x00 0x00) or stop (0xD1 0x00 0x01)
+template <uint8_t DestAddress, bool Start>
+using iSYSAcquisitionFrame = iSYSFrame<DestAddress, 0xD1, 0x00, Start ? 0x00 : 0x01>;
+
+// EEPROM command (0xDF) with an iSYSEEPROMSubFunction_t value
+template <uint8_t DestAddress, uint8_t SubFunction>
+using iSYSEEPROMFrame = iSYSFrame<DestAddress, 0xDF, SubFunction>;
+
+// Target list request (0xDA) for output 1-3 in 16-bit (0x10) or 32-bit (0x20) format
+template <uint8_t DestAddress, uint8_t Output, uint8_t Bitrate>
+using iSYSTargetListRequestFrame = iSYSFrame<DestAddress, ISYS_FRAME_FC_TARGET_LIST, Output, (Bitrate == 32) ? 0x20 : 0x10>;
+
+// The FCS must come out of the compiler, not the running program
+static_assert(iSYSFrameChecksum(0x80, 0x01, 0xD1, 0x00, 0x00) == 0x52, "iSYSFrameChecksum is not a constant expression");
+
+#endif
@@ -0,0 +1,301 @@
+#if !defined(ARDUINO)
+
+#include "iSYSPosixTransport.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief Constructor for the POSIX transport
+ *
+ * @note No descriptor is open until open() or attach() succeeds.
+ */
+iSYSPosixTransport::iSYSPosixTransport()
+    : _fd(-1), _ownsFd(false)
+{
+}
+
+/**
+ * @brief Destructor; closes a descriptor opened by open()
+ */
+iSYSPosixTransport::~iSYSPosixTransport()
+{
+    close();
+}
+
+/***************************************************************
+ *  CONNECTION FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Open and configure a serial device or PTY
+ *
+ * Configures the port for raw 8N1 operation at the requested baud rate without
+ * flow control. Baud rate setup is skipped for devices that are not terminals.
+ *
+ * @param path Device path, e.g. "/dev/ttyUSB0" or the slave side of a PTY
+ * @param baud Baud rate (9600 to 921600; 115200 for iSYS-4001)
+ *
+ * @return bool true on success, false if the device cannot be opened or configured
+ *
+ * @example
+ *   iSYSPosixTransport transport;
+ *   if (!transport.open("/dev/ttyUSB0", 115200)) {
+ *       perror("open");
+ *   }
+ */
+bool iSYSPosixTransport::open(const char *path, uint32_t baud)
+{
+    close();
+
+    int fd = ::open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    if (isatty(fd))
+    {
+        speed_t speed;
+        switch (baud)
+        {
+        case 9600:
+            speed = B9600;
+            break;
+        case 19200:
+            speed = B19200;
+            break;
+        case 38400:
+            speed = B38400;
+            break;
+        case 57600:
+            speed = B57600;
+            break;
+        case 115200:
+            speed = B115200;
+            break;
+#if defined(B230400)
+        case 230400:
+            speed = B230400;
+            break;
+#endif
+#if defined(B460800)
+        case 460800:
+            speed = B460800;
+            break;
+#endif
+#if defined(B921600)
+        case 921600:
+            speed = B921600;
+            break;
+#endif
+        default:
+            ::close(fd);
+            return false;
+        }
+
+        struct termios tty;
+        if (tcgetattr(fd, &tty) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        cfmakeraw(&tty);
+        tty.c_cflag |= (CLOCAL | CREAD);
+        tty.c_cflag &= ~(CSTOPB | PARENB);
+#if defined(CRTSCTS)
+        tty.c_cflag &= ~CRTSCTS;
+#endif
+        tty.c_cc[VMIN] = 0;
+        tty.c_cc[VTIME] = 0;
+        cfsetispeed(&tty, speed);
+        cfsetospeed(&tty, speed);
+
+        if (tcsetattr(fd, TCSANOW, &tty) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+        tcflush(fd, TCIOFLUSH);
+    }
+
+    _fd = fd;
+    _ownsFd = true;
+    return true;
+}
+
+/**
+ * @brief Use an already open descriptor (PTY master, connected socket, ...)
+ *
+ * @param fd Open file descriptor; it is switched to non-blocking mode but not closed by close()
+ *
+ * @return bool true on success, false if fd is invalid
+ *
+ * @example
+ *   int sock = connectToSerialServer();
+ *   transport.attach(sock);
+ */
+bool iSYSPosixTransport::attach(int fd)
+{
+    close();
+
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)
+    {
+        return false;
+    }
+
+    _fd = fd;
+    _ownsFd = false;
+    return true;
+}
+
+/**
+ * @brief Release the descriptor (closing it if it was opened by open())
+ */
+void iSYSPosixTransport::close()
+{
+    if (_fd >= 0 && _ownsFd)
+    {
+        ::close(_fd);
+    }
+    _fd = -1;
+    _ownsFd = false;
+}
+
+/**
+ * @brief Get the underlying file descriptor
+ *
+ * @return int Descriptor in use, or -1 if none
+ */
+int iSYSPosixTransport::fd() const
+{
+    return _fd;
+}
+
+/***************************************************************
+ *  iSYSTransport FUNCTIONS
+ ***************************************************************/
+
+/**
+ * @brief Write a block of bytes, waiting while the descriptor is full
+ *
+ * @param data Pointer to the bytes to send
+ * @param length Number of bytes to send
+ *
+ * @return size_t Number of bytes written; less than length only on an I/O error
+ */
+size_t iSYSPosixTransport::write(const uint8_t *data, size_t length)
+{
+    size_t written = 0;
+
+    while (_fd >= 0 && written < length)
+    {
+        ssize_t n = ::write(_fd, data + written, length - written);
+        if (n > 0)
+        {
+            written += (size_t)n;
+        }
+        else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            struct pollfd pfd = {_fd, POLLOUT, 0};
+            ::poll(&pfd, 1, 100);
+        }
+        else if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return written;
+}
+
+/**
+ * @brief Read received bytes without blocking
+ *
+ * @param data Destination buffer
+ * @param length Maximum number of bytes to read
+ *
+ * @return size_t Number of bytes read (0 if nothing is pending or on error)
+ */
+size_t iSYSPosixTransport::read(uint8_t *data, size_t length)
+{
+    if (_fd < 0)
+    {
+        return 0;
+    }
+
+    ssize_t n = ::read(_fd, data, length);
+    return (n > 0) ? (size_t)n : 0;
+}
+
+/**
+ * @brief Get the number of received bytes waiting in the descriptor
+ *
+ * @return int Number of bytes that can be read without blocking
+ */
+int iSYSPosixTransport::available()
+{
+    int pending = 0;
+
+    if (_fd < 0 || ioctl(_fd, FIONREAD, &pending) < 0)
+    {
+        return 0;
+    }
+
+    return pending;
+}
+
+/**
+ * @brief Wait until written bytes have left the serial port
+ *
+ * @note No-op for descriptors that are not terminals (sockets)
+ */
+void iSYSPosixTransport::flush()
+{
+    if (_fd >= 0 && isatty(_fd))
+    {
+        tcdrain(_fd);
+    }
+}
+
+/**
+ * @brief Get the monotonic millisecond clock
+ *
+ * @return uint32_t Milliseconds of CLOCK_MONOTONIC, wrapping like Arduino millis()
+ */
+uint32_t iSYSPosixTransport::millis()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u);
+}
+
+/**
+ * @brief Get the monotonic microsecond clock
+ *
+ * @return uint32_t Microseconds of CLOCK_MONOTONIC, wrapping like Arduino micros()
+ */
+uint32_t iSYSPosixTransport::micros()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u);
+}
+
+#endif
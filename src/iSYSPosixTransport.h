@@ -0,0 +1,61 @@
+#ifndef ISYSPOSIXTRANSPORT_H
+#define ISYSPOSIXTRANSPORT_H
+
+#if !defined(ARDUINO)
+
+#include "iSYSTransport.h"
+
+/**
+ * @brief iSYSTransport for POSIX hosts (Linux gateways, host-side tools)
+ *
+ * Talks to the sensor through a file descriptor: a serial device configured with
+ * termios (e.g. /dev/ttyUSB0), a PTY, or an already connected socket. The
+ * descriptor is switched to non-blocking mode; the clock is CLOCK_MONOTONIC.
+ *
+ * @note Only compiled on non-Arduino builds.
+ *
+ * @example
+ *   iSYSPosixTransport transport;
+ *   if (transport.open("/dev/ttyUSB0", 115200)) {
+ *       iSYS4001 radar(transport);
+ *       radar.iSYS_startAcquisition(0x80, 300);
+ *   }
+ */
+class iSYSPosixTransport : public iSYSTransport
+{
+
+public:
+    iSYSPosixTransport();
+    ~iSYSPosixTransport();
+
+    /***************************************************************
+     *  CONNECTION FUNCTIONS
+     ***************************************************************/
+    bool open(const char *path, uint32_t baud = 115200);
+    bool attach(int fd);
+    void close();
+    int fd() const;
+
+    /***************************************************************
+     *  iSYSTransport FUNCTIONS
+     ***************************************************************/
+    size_t write(const uint8_t *data, size_t length);
+    size_t read(uint8_t *data, size_t length);
+    int available();
+    void flush();
+
+    uint32_t millis();
+    uint32_t micros();
+
+private:
+    int _fd;
+    bool _ownsFd; // close() only closes descriptors opened by open()
+
+    // Non-copyable: the descriptor has a single owner
+    iSYSPosixTransport(const iSYSPosixTransport &);
+    iSYSPosixTransport &operator=(const iSYSPosixTransport &);
+};
+
+#endif
+
+#endif
@@ -0,0 +1,500 @@
+#include "iSYSTargetDecoder.h"
+
+#include <stddef.h>
+
+#if !defined(ISYS_DISABLE_SIMD) && defined(__x86_64__) && defined(__GNUC__)
+#define ISYS_DECODER_HAVE_X86 1
+#include <immintrin.h>
+#define ISYS_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define ISYS_TARGET_AVX2 __attribute__((target("avx2")))
+#elif !defined(ISYS_DISABLE_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+#define ISYS_DECODER_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+// Scale of each field in {signal, velocity, range, angle} order, shared by all kernels
+static const float scale32[4] = {0.01f, 0.001f, 1E-6f, 0.01f};
+static const float scale16[4] = {1.0f, 0.01f, 0.01f, 0.01f};
+
+// Kernel set of one instruction set
+typedef struct
+{
+    iSYSTargetDecoder_t decoder;
+    void (*targets16)(const uint8_t *records, uint8_t count, float *targets);
+    void (*targets32)(const uint8_t *records, uint8_t count, float *targets);
+    void (*columns16)(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle);
+    void (*columns32)(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle);
+} iSYSTargetKernels_t;
+
+/***************************************************************
+ *  SCALAR KERNELS
+ ***************************************************************/
+
+static void decodeTargets16Scalar(const uint8_t *records, uint8_t count, float *targets)
+{
+    for (uint8_t i = 0; i < count; i++, records += 7, targets += 4)
+    {
+        targets[0] = (float)records[0] * scale16[0];
+        targets[1] = (float)iSYSReadInt16(&records[1]) * scale16[1];
+        targets[2] = (float)iSYSReadInt16(&records[3]) * scale16[2];
+        targets[3] = (float)iSYSReadInt16(&records[5]) * scale16[3];
+    }
+}
+
+static void decodeTargets32Scalar(const uint8_t *records, uint8_t count, float *targets)
+{
+    for (uint8_t i = 0; i < count; i++, records += 14, targets += 4)
+    {
+        targets[0] = (float)iSYSReadInt16(&records[0]) * scale32[0];
+        targets[1] = (float)iSYSReadInt32(&records[2]) * scale32[1];
+        targets[2] = (float)iSYSReadInt32(&records[6]) * scale32[2];
+        targets[3] = (float)iSYSReadInt32(&records[10]) * scale32[3];
+    }
+}
+
+static void decodeColumns16Scalar(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle)
+{
+    for (uint8_t i = 0; i < count; i++, records += 7)
+    {
+        signal[i] = (float)records[0] * scale16[0];
+        velocity[i] = (float)iSYSReadInt16(&records[1]) * scale16[1];
+        range[i] = (float)iSYSReadInt16(&records[3]) * scale16[2];
+        angle[i] = (float)iSYSReadInt16(&records[5]) * scale16[3];
+    }
+}
+
+static void decodeColumns32Scalar(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle)
+{
+    for (uint8_t i = 0; i < count; i++, records += 14)
+    {
+        signal[i] = (float)iSYSReadInt16(&records[0]) * scale32[0];
+        velocity[i] = (float)iSYSReadInt32(&records[2]) * scale32[1];
+        range[i] = (float)iSYSReadInt32(&records[6]) * scale32[2];
+        angle[i] = (float)iSYSReadInt32(&records[10]) * scale32[3];
+    }
+}
+
+static const iSYSTargetKernels_t scalarKernels = {
+    ISYS_DECODER_SCALAR, decodeTargets16Scalar, decodeTargets32Scalar, decodeColumns16Scalar, decodeColumns32Scalar};
+
+#if defined(ISYS_DECODER_HAVE_X86)
+
+/***************************************************************
+ *  SSE4.1 KERNELS
+ ***************************************************************/
+
+/*
+ * One record per vector: a byte shuffle moves every field into its own 32-bit lane in
+ * little-endian order, an arithmetic shift sign-extends the 16-bit fields, then one
+ * conversion and one multiply produce {signal, velocity, range, angle}.
+ */
+ISYS_TARGET_SSE41 static inline __m128 decodeRecord16Sse41(const uint8_t *record)
+{
+    // 16-bit fields go to the upper half of their lane; the unsigned signal byte gets a zero top byte
+    const __m128i order = _mm_setr_epi8(-1, -1, 0, -1, -1, -1, 2, 1, -1, -1, 4, 3, -1, -1, 6, 5);
+    __m128i fields = _mm_shuffle_epi8(_mm_loadl_epi64((const __m128i *)record), order);
+    fields = _mm_srai_epi32(fields, 16);
+    return _mm_mul_ps(_mm_cvtepi32_ps(fields), _mm_loadu_ps(scale16));
+}
+
+ISYS_TARGET_SSE41 static inline __m128 decodeRecord32Sse41(const uint8_t *record)
+{
+    // The int16 signal goes to the upper half of lane 0 and is shifted down alone
+    const __m128i order = _mm_setr_epi8(-1, -1, 1, 0, 5, 4, 3, 2, 9, 8, 7, 6, 13, 12, 11, 10);
+    __m128i fields = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)record), order);
+    fields = _mm_blend_epi16(fields, _mm_srai_epi32(fields, 16), 0x03);
+    return _mm_mul_ps(_mm_cvtepi32_ps(fields), _mm_loadu_ps(scale32));
+}
+
+ISYS_TARGET_SSE41 static void decodeTargets16Sse41(const uint8_t *records, uint8_t count, float *targets)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        _mm_storeu_ps(&targets[4 * i], decodeRecord16Sse41(&records[7 * i]));
+    }
+}
+
+ISYS_TARGET_SSE41 static void decodeTargets32Sse41(const uint8_t *records, uint8_t count, float *targets)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        _mm_storeu_ps(&targets[4 * i], decodeRecord32Sse41(&records[14 * i]));
+    }
+}
+
+ISYS_TARGET_SSE41 static void decodeColumns16Sse41(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle)
+{
+    uint8_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 t0 = decodeRecord16Sse41(&records[7 * i]);
+        __m128 t1 = decodeRecord16Sse41(&records[7 * (i + 1)]);
+        __m128 t2 = decodeRecord16Sse41(&records[7 * (i + 2)]);
+        __m128 t3 = decodeRecord16Sse41(&records[7 * (i + 3)]);
+        _MM_TRANSPOSE4_PS(t0, t1, t2, t3);
+        _mm_storeu_ps(&signal[i], t0);
+        _mm_storeu_ps(&velocity[i], t1);
+        _mm_storeu_ps(&range[i], t2);
+        _mm_storeu_ps(&angle[i], t3);
+    }
+    decodeColumns16Scalar(&records[7 * i], count - i, &signal[i], &velocity[i], &range[i], &angle[i]);
+}
+
+ISYS_TARGET_SSE41 static void decodeColumns32Sse41(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle)
+{
+    uint8_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 t0 = decodeRecord32Sse41(&records[14 * i]);
+        __m128 t1 = decodeRecord32Sse41(&records[14 * (i + 1)]);
+        __m128 t2 = decodeRecord32Sse41(&records[14 * (i + 2)]);
+        __m128 t3 = decodeRecord32Sse41(&records[14 * (i + 3)]);
+        _MM_TRANSPOSE4_PS(t0, t1, t2, t3);
+        _mm_storeu_ps(&signal[i], t0);
+        _mm_storeu_ps(&velocity[i], t1);
+        _mm_storeu_ps(&range[i], t2);
+        _mm_storeu_ps(&angle[i], t3);
+    }
+    decodeColumns32Scalar(&records[14 * i], count - i, &signal[i], &velocity[i], &range[i], &angle[i]);
+}
+
+static const iSYSTargetKernels_t sse41Kernels = {
+    ISYS_DECODER_SSE41, decodeTargets16Sse41, decodeTargets32Sse41, decodeColumns16Sse41, decodeColumns32Sse41};
+
+/***************************************************************
+ *  AVX2 KERNELS
+ ***************************************************************/
+
+/*
+ * Two records per vector, one in each 128-bit lane; byte shuffles and shifts work per
+ * lane, so the steps are those of the SSE4.1 kernel. The remaining records go to the
+ * SSE4.1 kernel after _mm256_zeroupper(): compilers do not always emit it before a
+ * tail call, and legacy SSE code with dirty upper halves runs several times slower.
+ */
+ISYS_TARGET_AVX2 static inline __m256 decodeRecordPair16Avx2(const uint8_t *first, const uint8_t *second)
+{
+    const __m256i order = _mm256_setr_epi8(-1, -1, 0, -1, -1, -1, 2, 1, -1, -1, 4, 3, -1, -1, 6, 5,
+                                           -1, -1, 0, -1, -1, -1, 2, 1, -1, -1, 4, 3, -1, -1, 6, 5);
+    const __m256i bytes = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadl_epi64((const __m128i *)first)),
+                                                  _mm_loadl_epi64((const __m128i *)second), 1);
+    const __m256i fields = _mm256_srai_epi32(_mm256_shuffle_epi8(bytes, order), 16);
+    return _mm256_mul_ps(_mm256_cvtepi32_ps(fields), _mm256_broadcast_ps((const __m128 *)scale16));
+}
+
+ISYS_TARGET_AVX2 static inline __m256 decodeRecordPair32Avx2(const uint8_t *first, const uint8_t *second)
+{
+    const __m256i order = _mm256_setr_epi8(-1, -1, 1, 0, 5, 4, 3, 2, 9, 8, 7, 6, 13, 12, 11, 10,
+                                           -1, -1, 1, 0, 5, 4, 3, 2, 9, 8, 7, 6, 13, 12, 11, 10);
+    const __m256i bytes = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)first)),
+                                                  _mm_loadu_si128((const __m128i *)second), 1);
+    __m256i fields = _mm256_shuffle_epi8(bytes, order);
+    fields = _mm256_blend_epi16(fields, _mm256_srai_epi32(fields, 16), 0x03);
+    return _mm256_mul_ps(_mm256_cvtepi32_ps(fields), _mm256_broadcast_ps((const __m128 *)scale32));
+}
+
+/*
+ * Rows hold targets (k, k + 4) for k = 0..3; transposing within each lane leaves
+ * targets 0-3 of a field in the low lane and 4-7 in the high lane.
+ */
+ISYS_TARGET_AVX2 static inline void storeColumnsAvx2(__m256 r0, __m256 r1, __m256 r2, __m256 r3, float *signal, float *velocity, float *range, float *angle)
+{
+    const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    _mm256_storeu_ps(signal, _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)));
+    _mm256_storeu_ps(velocity, _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)));
+    _mm256_storeu_ps(range, _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)));
+    _mm256_storeu_ps(angle, _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)));
+}
+
+ISYS_TARGET_AVX2 static void decodeTargets16Avx2(const uint8_t *records, uint8_t count, float *targets)
+{
+    uint8_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        _mm256_storeu_ps(&targets[4 * i], decodeRecordPair16Avx2(&records[7 * i], &records[7 * (i + 1)]));
+    }
+    _mm256_zeroupper();
+    decodeTargets16Sse41(&records[7 * i], count - i, &targets[4 * i]);
+}
+
+ISYS_TARGET_AVX2 static void decodeTargets32Avx2(const uint8_t *records, uint8_t count, float *targets)
+{
+    uint8_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        _mm256_storeu_ps(&targets[4 * i], decodeRecordPair32Avx2(&records[14 * i], &records[14 * (i + 1)]));
+    }
+    _mm256_zeroupper();
+    decodeTargets32Sse41(&records[14 * i], count - i, &targets[4 * i]);
+}
+
+ISYS_TARGET_AVX2 static void decodeColumns16Avx2(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle)
+{
+    uint8_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const uint8_t *block = &records[7 * i];
+        storeColumnsAvx2(decodeRecordPair16Avx2(&block[0], &block[28]), decodeRecordPair16Avx2(&block[7], &block[35]),
+                         decodeRecordPair16Avx2(&block[14], &block[42]), decodeRecordPair16Avx2(&block[21], &block[49]),
+                         &signal[i], &velocity[i], &range[i], &angle[i]);
+    }
+    _mm256_zeroupper();
+    decodeColumns16Sse41(&records[7 * i], count - i, &signal[i], &velocity[i], &range[i], &angle[i]);
+}
+
+ISYS_TARGET_AVX2 static void decodeColumns32Avx2(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle)
+{
+    uint8_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const uint8_t *block = &records[14 * i];
+        storeColumnsAvx2(decodeRecordPair32Avx2(&block[0], &block[56]), decodeRecordPair32Avx2(&block[14], &block[70]),
+                         decodeRecordPair32Avx2(&block[28], &block[84]), decodeRecordPair32Avx2(&block[42], &block[98]),
+                         &signal[i], &velocity[i], &range[i], &angle[i]);
+    }
+    _mm256_zeroupper();
+    decodeColumns32Sse41(&records[14 * i], count - i, &signal[i], &velocity[i], &range[i], &angle[i]);
+}
+
+static const iSYSTargetKernels_t avx2Kernels = {
+    ISYS_DECODER_AVX2, decodeTargets16Avx2, decodeTargets32Avx2, decodeColumns16Avx2, decodeColumns32Avx2};
+
+#endif
+
+#if defined(ISYS_DECODER_HAVE_NEON)
+
+/***************************************************************
+ *  NEON KERNELS
+ ***************************************************************/
+
+// Same steps as the SSE4.1 kernel; table lookups with index 0xFF produce zero bytes
+static inline float32x4_t decodeRecord16Neon(const uint8_t *record)
+{
+    static const uint8_t order[16] = {0xFF, 0xFF, 0, 0xFF, 0xFF, 0xFF, 2, 1, 0xFF, 0xFF, 4, 3, 0xFF, 0xFF, 6, 5};
+    const uint8x16_t bytes = vcombine_u8(vld1_u8(record), vdup_n_u8(0));
+    const int32x4_t fields = vshrq_n_s32(vreinterpretq_s32_u8(vqtbl1q_u8(bytes, vld1q_u8(order))), 16);
+    return vmulq_f32(vcvtq_f32_s32(fields), vld1q_f32(scale16));
+}
+
+static inline float32x4_t decodeRecord32Neon(const uint8_t *record)
+{
+    static const uint8_t order[16] = {0xFF, 0xFF, 1, 0, 5, 4, 3, 2, 9, 8, 7, 6, 13, 12, 11, 10};
+    static const uint32_t signalLane[4] = {0xFFFFFFFFu, 0, 0, 0};
+    const int32x4_t fields = vreinterpretq_s32_u8(vqtbl1q_u8(vld1q_u8(record), vld1q_u8(order)));
+    const int32x4_t extended = vbslq_s32(vld1q_u32(signalLane), vshrq_n_s32(fields, 16), fields);
+    return vmulq_f32(vcvtq_f32_s32(extended), vld1q_f32(scale32));
+}
+
+static inline void storeColumnsNeon(float32x4_t t0, float32x4_t t1, float32x4_t t2, float32x4_t t3, float *signal, float *velocity, float *range, float *angle)
+{
+    const float32x4x2_t p01 = vtrnq_f32(t0, t1);
+    const float32x4x2_t p23 = vtrnq_f32(t2, t3);
+    vst1q_f32(signal, vcombine_f32(vget_low_f32(p01.val[0]), vget_low_f32(p23.val[0])));
+    vst1q_f32(velocity, vcombine_f32(vget_low_f32(p01.val[1]), vget_low_f32(p23.val[1])));
+    vst1q_f32(range, vcombine_f32(vget_high_f32(p01.val[0]), vget_high_f32(p23.val[0])));
+    vst1q_f32(angle, vcombine_f32(vget_high_f32(p01.val[1]), vget_high_f32(p23.val[1])));
+}
+
+static void decodeTargets16Neon(const uint8_t *records, uint8_t count, float *targets)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        vst1q_f32(&targets[4 * i], decodeRecord16Neon(&records[7 * i]));
+    }
+}
+
+static void decodeTargets32Neon(const uint8_t *records, uint8_t count, float *targets)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        vst1q_f32(&targets[4 * i], decodeRecord32Neon(&records[14 * i]));
+    }
+}
+
+static void decodeColumns16Neon(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle)
+{
+    uint8_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint8_t *block = &records[7 * i];
+        storeColumnsNeon(decodeRecord16Neon(&block[0]), decodeRecord16Neon(&block[7]), decodeRecord16Neon(&block[14]),
+                         decodeRecord16Neon(&block[21]), &signal[i], &velocity[i], &range[i], &angle[i]);
+    }
+    decodeColumns16Scalar(&records[7 * i], count - i, &signal[i], &velocity[i], &range[i], &angle[i]);
+}
+
+static void decodeColumns32Neon(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle)
+{
+    uint8_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint8_t *block = &records[14 * i];
+        storeColumnsNeon(decodeRecord32Neon(&block[0]), decodeRecord32Neon(&block[14]), decodeRecord32Neon(&block[28]),
+                         decodeRecord32Neon(&block[42]), &signal[i], &velocity[i], &range[i], &angle[i]);
+    }
+    decodeColumns32Scalar(&records[14 * i], count - i, &signal[i], &velocity[i], &range[i], &angle[i]);
+}
+
+static const iSYSTargetKernels_t neonKernels = {
+    ISYS_DECODER_NEON, decodeTargets16Neon, decodeTargets32Neon, decodeColumns16Neon, decodeColumns32Neon};
+
+#endif
+
+/***************************************************************
+ *  KERNEL SELECTION
+ ***************************************************************/
+
+// Kernels in use; chosen by ISYS_DECODER_AUTO on first use
+static const iSYSTargetKernels_t *activeKernels = NULL;
+
+/**
+ * @brief Internal function to look up the kernels of a decoder
+ *
+ * @return const iSYSTargetKernels_t* Kernel set, or NULL if the build or the CPU lacks the instruction set
+ */
+static const iSYSTargetKernels_t *findKernels(iSYSTargetDecoder_t decoder)
+{
+    switch (decoder)
+    {
+    case ISYS_DECODER_AUTO:
+    {
+        const iSYSTargetKernels_t *kernels = findKernels(ISYS_DECODER_AVX2);
+        if (kernels == NULL)
+            kernels = findKernels(ISYS_DECODER_SSE41);
+        if (kernels == NULL)
+            kernels = findKernels(ISYS_DECODER_NEON);
+        return (kernels != NULL) ? kernels : &scalarKernels;
+    }
+    case ISYS_DECODER_SCALAR:
+        return &scalarKernels;
+#if defined(ISYS_DECODER_HAVE_X86)
+    case ISYS_DECODER_SSE41:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.1") ? &sse41Kernels : NULL;
+    case ISYS_DECODER_AVX2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") ? &avx2Kernels : NULL;
+#endif
+#if defined(ISYS_DECODER_HAVE_NEON)
+    case ISYS_DECODER_NEON:
+        return &neonKernels;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+static inline const iSYSTargetKernels_t *kernels()
+{
+    if (activeKernels == NULL)
+    {
+        activeKernels = findKernels(ISYS_DECODER_AUTO);
+    }
+    return activeKernels;
+}
+
+/**
+ * @brief Select the kernel used by every target list decode in the process
+ *
+ * @param decoder Kernel to use, or ISYS_DECODER_AUTO for the fastest one available
+ *
+ * @return bool true on success, false if this build or CPU does not support the kernel
+ *         (the previous selection stays active)
+ *
+ * @note Intended for start-up, benchmarks and tests; do not switch while another
+ *       thread is decoding.
+ */
+bool iSYSSetTargetDecoder(iSYSTargetDecoder_t decoder)
+{
+    const iSYSTargetKernels_t *selected = findKernels(decoder);
+    if (selected == NULL)
+    {
+        return false;
+    }
+    activeKernels = selected;
+    return true;
+}
+
+/**
+ * @brief Get the kernel in use
+ *
+ * @return iSYSTargetDecoder_t Active kernel; never ISYS_DECODER_AUTO
+ */
+iSYSTargetDecoder_t iSYSGetTargetDecoder()
+{
+    return kernels()->decoder;
+}
+
+/**
+ * @brief Get the printable name of a kernel
+ *
+ * @return const char* "auto", "scalar", "sse4.1", "avx2", "neon" or "unknown"
+ */
+const char *iSYSTargetDecoderName(iSYSTargetDecoder_t decoder)
+{
+    switch (decoder)
+    {
+    case ISYS_DECODER_AUTO:
+        return "auto";
+    case ISYS_DECODER_SCALAR:
+        return "scalar";
+    case ISYS_DECODER_SSE41:
+        return "sse4.1";
+    case ISYS_DECODER_AVX2:
+        return "avx2";
+    case ISYS_DECODER_NEON:
+        return "neon";
+    default:
+        return "unknown";
+    }
+}
+
+/**
+ * @brief Decode 16-bit target records into interleaved {signal, velocity, range, angle} floats
+ *
+ * @param records First record (7 bytes each)
+ * @param count Number of records
+ * @param targets Destination, 4 floats per target
+ */
+void iSYSDecodeTargets16(const uint8_t *records, uint8_t count, float *targets)
+{
+    kernels()->targets16(records, count, targets);
+}
+
+/**
+ * @brief Decode 32-bit target records into interleaved {signal, velocity, range, angle} floats
+ *
+ * @param records First record (14 bytes each)
+ * @param count Number of records
+ * @param targets Destination, 4 floats per target
+ */
+void iSYSDecodeTargets32(const uint8_t *records, uint8_t count, float *targets)
+{
+    kernels()->targets32(records, count, targets);
+}
+
+/**
+ * @brief Decode 16-bit target records into one array per field
+ *
+ * @param records First record (7 bytes each)
+ * @param count Number of records
+ * @param signal, velocity, range, angle Destination arrays, count floats each
+ */
+void iSYSDecodeColumns16(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle)
+{
+    kernels()->columns16(records, count, signal, velocity, range, angle);
+}
+
+/**
+ * @brief Decode 32-bit target records into one array per field
+ *
+ * @param records First record (14 bytes each)
+ * @param count Number of records
+ * @param signal, velocity, range, angle Destination arrays, count floats each
+ */
+void iSYSDecodeColumns32(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle)
+{
+    kernels()->columns32(records, count, signal, velocity, range, angle);
+}
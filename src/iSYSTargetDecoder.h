@@ -0,0 +1,75 @@
+#ifndef ISYSTARGETDECODER_H
+#define ISYSTARGETDECODER_H
+
+#include <stdint.h>
+
+/*
+ * Target record kernels
+ *
+ * Convert the target records of a target list frame into floats: big-endian byte
+ * swap, sign extension and scaling to dB, m/s, m and degrees.
+ *
+ *   32-bit record (14 bytes): int16 signal (0.01 dB), int32 velocity (mm/s), int32 range (µm), int32 angle (0.01°)
+ *   16-bit record (7 bytes):  uint8 signal (dB), int16 velocity (cm/s), int16 range (cm), int16 angle (0.01°)
+ *
+ * Besides the portable scalar kernel there are SIMD kernels for hosts that decode
+ * many sensors (SSE4.1 and AVX2 on x86-64, NEON on AArch64). The fastest kernel the
+ * CPU supports is selected at run time on first use. Every kernel performs the same
+ * single int-to-float conversion and single float multiply per field as the scalar
+ * kernel, so all of them produce bit-identical results.
+ *
+ * Arduino targets and other architectures only build the scalar kernel. Defining
+ * ISYS_DISABLE_SIMD for the whole build does the same on x86-64 and AArch64.
+ *
+ * @note Kernels read up to 2 bytes past the last record; a complete frame always
+ *       has its FCS and end delimiter there.
+ *
+ * @example
+ *   // Compare the scalar reference against the automatically selected kernel
+ *   iSYSSetTargetDecoder(ISYS_DECODER_SCALAR);
+ *   radar.decodeTargetList(frame, length, &reference);
+ *   iSYSSetTargetDecoder(ISYS_DECODER_AUTO);
+ *   radar.decodeTargetList(frame, length, &targetList);
+ */
+
+/**
+ * @brief Target record kernel
+ */
+typedef enum iSYSTargetDecoder
+{
+    ISYS_DECODER_AUTO = 0, // fastest kernel the CPU supports
+    ISYS_DECODER_SCALAR,   // portable C++, the reference for all other kernels
+    ISYS_DECODER_SSE41,    // x86-64 SSE4.1, one target per vector
+    ISYS_DECODER_AVX2,     // x86-64 AVX2, two targets per vector
+    ISYS_DECODER_NEON      // AArch64 NEON, one target per vector
+} iSYSTargetDecoder_t;
+
+bool iSYSSetTargetDecoder(iSYSTargetDecoder_t decoder);
+iSYSTargetDecoder_t iSYSGetTargetDecoder();
+const char *iSYSTargetDecoderName(iSYSTargetDecoder_t decoder);
+
+// Decode count records into interleaved {signal, velocity, range, angle} floats (iSYSTarget_t layout)
+void iSYSDecodeTargets16(const uint8_t *records, uint8_t count, float *targets);
+void iSYSDecodeTargets32(const uint8_t *records, uint8_t count, float *targets);
+
+// Decode count records into one array per field (iSYSTargetArrays_t layout)
+void iSYSDecodeColumns16(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle);
+void iSYSDecodeColumns32(const uint8_t *records, uint8_t count, float *signal, float *velocity, float *range, float *angle);
+
+/**
+ * @brief Read a big-endian int16 record field
+ */
+inline int16_t iSYSReadInt16(const uint8_t *data)
+{
+    return (int16_t)(((uint16_t)data[0] << 8) | (uint16_t)data[1]);
+}
+
+/**
+ * @brief Read a big-endian int32 record field
+ */
+inline int32_t iSYSReadInt32(const uint8_t *data)
+{
+    return (int32_t)(((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | (uint32_t)data[3]);
+}
+
+#endif
@@ -0,0 +1,84 @@
+#include "iSYSTransport.h"
+
+#if defined(ARDUINO)
+
+/**
+ * @brief Constructor for the HardwareSerial transport adapter
+ *
+ * @param serial Pointer to the HardwareSerial port connected to the sensor
+ *
+ * @example
+ *   iSYSArduinoTransport transport(&Serial2);
+ */
+iSYSArduinoTransport::iSYSArduinoTransport(HardwareSerial *serial)
+    : _serial(serial)
+{
+}
+
+/**
+ * @brief Write a block of bytes to the UART
+ *
+ * @param data Pointer to the bytes to send
+ * @param length Number of bytes to send
+ *
+ * @return size_t Number of bytes accepted by the UART driver
+ */
+size_t iSYSArduinoTransport::write(const uint8_t *data, size_t length)
+{
+    return _serial->write(data, length);
+}
+
+/**
+ * @brief Read a block of received bytes from the UART
+ *
+ * @param data Destination buffer
+ * @param length Number of bytes to read (at most what available() reported)
+ *
+ * @return size_t Number of bytes read
+ *
+ * @note Uses readBytes(), which ESP32 and other cores implement as one bulk driver call.
+ */
+size_t iSYSArduinoTransport::read(uint8_t *data, size_t length)
+{
+    return _serial->readBytes(data, length);
+}
+
+/**
+ * @brief Get the number of received bytes waiting in the UART buffer
+ *
+ * @return int Number of bytes that can be read without blocking
+ */
+int iSYSArduinoTransport::available()
+{
+    return _serial->available();
+}
+
+/**
+ * @brief Wait until all written bytes have been transmitted
+ */
+void iSYSArduinoTransport::flush()
+{
+    _serial->flush();
+}
+
+/**
+ * @brief Get the Arduino millisecond clock
+ *
+ * @return uint32_t Milliseconds since start-up (Arduino millis())
+ */
+uint32_t iSYSArduinoTransport::millis()
+{
+    return ::millis();
+}
+
+/**
+ * @brief Get the Arduino microsecond clock
+ *
+ * @return uint32_t Microseconds since start-up (Arduino micros())
+ */
+uint32_t iSYSArduinoTransport::micros()
+{
+    return ::micros();
+}
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef ISYSTRANSPORT_H
+#define ISYSTRANSPORT_H
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <stdint.h>
+#include <stddef.h>
+#endif
+
+/**
+ * @brief Byte transport and clock used by the iSYS protocol stack
+ *
+ * Decouples the driver from Arduino's HardwareSerial and millis(), so the same
+ * framing, transaction and decoding code runs on a microcontroller UART, a Linux
+ * serial port, a PTY or a socket. Implementations must not block in read() or
+ * available(); the driver only requests as many bytes as available() reported.
+ *
+ * @note Ready-made implementations: iSYSArduinoTransport (HardwareSerial, Arduino
+ *       builds) and iSYSPosixTransport (termios/PTY/socket file descriptor, host builds).
+ *
+ * @example
+ *   class MyTransport : public iSYSTransport {
+ *       // implement write/read/available/flush/millis/micros
+ *   };
+ *   MyTransport transport;
+ *   iSYS4001 radar(transport);
+ */
+class iSYSTransport
+{
+
+public:
+    virtual ~iSYSTransport() {}
+
+    /***************************************************************
+     *  BYTE STREAM FUNCTIONS
+     ***************************************************************/
+    virtual size_t write(const uint8_t *data, size_t length) = 0; // returns bytes accepted
+    virtual size_t read(uint8_t *data, size_t length) = 0;        // returns bytes read, never blocks
+    virtual int available() = 0;                                  // bytes ready to read
+    virtual void flush() = 0;                                     // wait until written bytes are sent
+
+    /***************************************************************
+     *  MONOTONIC CLOCK FUNCTIONS
+     ***************************************************************/
+    virtual uint32_t millis() = 0; // wraps like Arduino millis()
+    virtual uint32_t micros() = 0; // wraps like Arduino micros()
+};
+
+#if defined(ARDUINO)
+
+/**
+ * @brief iSYSTransport adapter for an Arduino HardwareSerial port
+ *
+ * Used internally by the iSYS4001(HardwareSerial &, uint32_t) constructor; the
+ * clock functions forward to Arduino millis()/micros().
+ *
+ * @note The serial port must be started (begin()) by the sketch.
+ *
+ * @example
+ *   iSYSArduinoTransport transport(&Serial2);
+ *   iSYS4001 radar(transport);
+ */
+class iSYSArduinoTransport : public iSYSTransport
+{
+
+public:
+    iSYSArduinoTransport(HardwareSerial *serial);
+
+    size_t write(const uint8_t *data, size_t length);
+    size_t read(uint8_t *data, size_t length);
+    int available();
+    void flush();
+
+    uint32_t millis();
+    uint32_t micros();
+
+private:
+    HardwareSerial *_serial;
+};
+
+#endif
+
+#endif
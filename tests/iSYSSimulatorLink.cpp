@@ -0,0 +1,148 @@
+#include "iSYSSimulatorLink.h"
+
+#include <string.h>
+
+/***************************************************************
+ *  LOOPBACK TRANSPORT
+ ***************************************************************/
+
+/**
+ * @brief Constructor for one end of the loopback link
+ *
+ * @param clock Shared virtual time in µs; read by millis() and micros()
+ */
+iSYSLoopbackTransport::iSYSLoopbackTransport(const uint32_t *clock)
+    : _clock(clock), _peer(NULL), _head(0), _length(0)
+{
+}
+
+/**
+ * @brief Connect this end to the end that receives its writes
+ *
+ * @param peer Other end of the link
+ */
+void iSYSLoopbackTransport::connect(iSYSLoopbackTransport *peer)
+{
+    _peer = peer;
+}
+
+size_t iSYSLoopbackTransport::write(const uint8_t *data, size_t length)
+{
+    if (_peer == NULL)
+    {
+        return 0;
+    }
+    return _peer->receive(data, length);
+}
+
+size_t iSYSLoopbackTransport::read(uint8_t *data, size_t length)
+{
+    if (length > _length)
+    {
+        length = _length;
+    }
+    memcpy(data, &_buffer[_head], length);
+    _head += length;
+    _length -= length;
+    if (_length == 0)
+    {
+        _head = 0;
+    }
+    return length;
+}
+
+int iSYSLoopbackTransport::available()
+{
+    return (int)_length;
+}
+
+void iSYSLoopbackTransport::flush()
+{
+}
+
+uint32_t iSYSLoopbackTransport::millis()
+{
+    return *_clock / 1000u;
+}
+
+uint32_t iSYSLoopbackTransport::micros()
+{
+    return *_clock;
+}
+
+/**
+ * @brief Append bytes to the receive buffer
+ *
+ * @return size_t Bytes accepted; fewer than length once the buffer is full
+ */
+size_t iSYSLoopbackTransport::receive(const uint8_t *data, size_t length)
+{
+    if (_head + _length + length > sizeof(_buffer))
+    {
+        memmove(_buffer, &_buffer[_head], _length);
+        _head = 0;
+    }
+    if (length > sizeof(_buffer) - _length)
+    {
+        length = sizeof(_buffer) - _length;
+    }
+    memcpy(&_buffer[_head + _length], data, length);
+    _length += length;
+    return length;
+}
+
+/***************************************************************
+ *  SIMULATOR LINK
+ ***************************************************************/
+
+/**
+ * @brief Constructor for the driver's end of a link to a fresh simulator
+ *
+ * @param address Device address of the simulator after a factory reset (default 0x80)
+ *
+ * @note The simulator is unpaced (baud 0) and fault free until the test configures it.
+ */
+iSYSSimulatorLink::iSYSSimulatorLink(uint8_t address)
+    : iSYSLoopbackTransport(&_clock), _clock(0), _sensorEnd(&_clock), _simulator(_sensorEnd, address)
+{
+    connect(&_sensorEnd);
+    _sensorEnd.connect(this);
+}
+
+iSYSSimulator &iSYSSimulatorLink::simulator()
+{
+    return _simulator;
+}
+
+/**
+ * @brief Make bytes readable by the driver ahead of anything the simulator sends later
+ *
+ * @param data Bytes as they would arrive on the line (garbage, partial frames, ...)
+ * @param length Number of bytes
+ */
+void iSYSSimulatorLink::inject(const uint8_t *data, size_t length)
+{
+    receive(data, length);
+}
+
+/**
+ * @brief Let virtual time pass without the driver reading
+ *
+ * @param us Time to advance in µs; the simulator runs once per ISYS_LINK_POLL_STEP
+ */
+void iSYSSimulatorLink::advance(uint32_t us)
+{
+    while (us > 0)
+    {
+        const uint32_t step = (us < ISYS_LINK_POLL_STEP) ? us : ISYS_LINK_POLL_STEP;
+        _clock += step;
+        us -= step;
+        _simulator.poll();
+    }
+}
+
+int iSYSSimulatorLink::available()
+{
+    advance(ISYS_LINK_POLL_STEP);
+    return iSYSLoopbackTransport::available();
+}
@@ -0,0 +1,82 @@
+#ifndef ISYSSIMULATORLINK_H
+#define ISYSSIMULATORLINK_H
+
+#include "iSYSSimulator.h"
+
+// Bytes one direction of the loopback link can hold before write() refuses more
+#define ISYS_LOOPBACK_BUFFER_SIZE (1024)
+
+// Virtual µs that pass on every available() call of the driver's end
+#define ISYS_LINK_POLL_STEP (50)
+
+/**
+ * @brief One end of an in-memory byte link driven by a shared virtual clock
+ *
+ * Bytes written to one end become readable at the other end right away. The
+ * clock functions return the shared virtual time, so tests run at full speed and
+ * repeat exactly for a given simulator seed.
+ *
+ * @note Test helper; not part of the Arduino library.
+ */
+class iSYSLoopbackTransport : public iSYSTransport
+{
+
+public:
+    explicit iSYSLoopbackTransport(const uint32_t *clock);
+
+    void connect(iSYSLoopbackTransport *peer);
+
+    size_t write(const uint8_t *data, size_t length);
+    size_t read(uint8_t *data, size_t length);
+    int available();
+    void flush();
+
+    uint32_t millis();
+    uint32_t micros();
+
+private:
+    const uint32_t *_clock;
+    iSYSLoopbackTransport *_peer;
+    uint8_t _buffer[ISYS_LOOPBACK_BUFFER_SIZE];
+    size_t _head;   // next byte to read
+    size_t _length; // bytes waiting in _buffer
+
+protected:
+    size_t receive(const uint8_t *data, size_t length);
+};
+
+/**
+ * @brief Driver-side transport with an iSYSSimulator at the other end
+ *
+ * Every available() call advances the virtual clock by ISYS_LINK_POLL_STEP µs and
+ * lets the simulator run, so the blocking calls and poll() of iSYS4001 see the
+ * simulated latency, pacing and faults exactly as on a serial port. Bytes can be
+ * injected in front of the simulator's responses to model line noise.
+ *
+ * @note Test helper; not part of the Arduino library.
+ *
+ * @example
+ *   iSYSSimulatorLink link;
+ *   iSYS4001 radar(link);
+ *   link.simulator().setFaults(faults);
+ *   radar.getTargetList16(&targets, 0x80, 300);
+ */
+class iSYSSimulatorLink : public iSYSLoopbackTransport
+{
+
+public:
+    explicit iSYSSimulatorLink(uint8_t address = 0x80);
+
+    iSYSSimulator &simulator();
+    void inject(const uint8_t *data, size_t length);
+    void advance(uint32_t us);
+
+    int available();
+
+private:
+    uint32_t _clock;
+    iSYSLoopbackTransport _sensorEnd;
+    iSYSSimulator _simulator;
+};
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef ISYSTEST_H
+#define ISYSTEST_H
+
+#include <stdio.h>
+
+/**
+ * Minimal check macros for the host-side tests
+ *
+ * Each test program runs its cases from main() and returns ISYS_TEST_EXIT_CODE(),
+ * so ctest reports a failure as soon as one check failed. Failed checks print the
+ * expression and its location and let the program continue.
+ *
+ *   static void testSomething()
+ *   {
+ *       ISYS_CHECK(radar.getTargetList16(&targets, 0x80, 300) == ERR_OK);
+ *   }
+ *
+ *   int main()
+ *   {
+ *       testSomething();
+ *       return ISYS_TEST_EXIT_CODE();
+ *   }
+ */
+
+static unsigned iSYSTestChecks = 0;
+static unsigned iSYSTestFailures = 0;
+
+static inline bool iSYSTestCheck(bool passed, const char *expression, const char *file, int line)
+{
+    iSYSTestChecks++;
+    if (!passed)
+    {
+        iSYSTestFailures++;
+        fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+    }
+    return passed;
+}
+
+static inline int iSYSTestExitCode()
+{
+    printf("%u checks, %u failed\n", iSYSTestChecks, iSYSTestFailures);
+    return (iSYSTestFailures == 0) ? 0 : 1;
+}
+
+#define ISYS_CHECK(condition) iSYSTestCheck((condition), #condition, __FILE__, __LINE__)
+#define ISYS_TEST_EXIT_CODE() iSYSTestExitCode()
+
+#endif
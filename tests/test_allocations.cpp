@@ -0,0 +1,147 @@
+/*
+ * Heap use of the target list receive path
+ *
+ * Replaces the global operator new/delete with counting versions and receives
+ * target lists from the simulator in every format and list type, blocking,
+ * non-blocking and streamed. Steady-state polling must not allocate at all, so
+ * the driver can run for weeks on an ESP32 without fragmenting the heap.
+ */
+
+#include "iSYS4001.h"
+#include "iSYSSimulatorLink.h"
+#include "iSYSTest.h"
+
+#include <new>
+#include <stdlib.h>
+
+static unsigned long g_allocations = 0;
+
+void *operator new(size_t size)
+{
+    g_allocations++;
+    void *p = malloc(size ? size : 1);
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    g_allocations++;
+    return malloc(size ? size : 1);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    return operator new(size, std::nothrow);
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void *p, size_t) noexcept
+{
+    free(p);
+}
+
+// Receives per case; enough to reach every steady state (buffers, stream re-arm)
+#define RECEIVES (50)
+
+static iSYSTargetList_t g_list;
+static iSYSTargetArrays_t g_arrays;
+static iSYSTargetListFixed_t g_fixed;
+
+template <typename TargetList>
+static void receiveBlocking(iSYS4001 &radar, TargetList *targetList)
+{
+    for (unsigned i = 0; i < RECEIVES; i++)
+    {
+        ISYS_CHECK(radar.getTargetList16(targetList, 0x80, 300) == ERR_OK);
+        ISYS_CHECK(radar.getTargetList32(targetList, 0x80, 300) == ERR_OK);
+    }
+}
+
+static void testBlockingReceive(iSYS4001 &radar)
+{
+    const unsigned long before = g_allocations;
+    receiveBlocking(radar, &g_list);
+    receiveBlocking(radar, &g_arrays);
+    receiveBlocking(radar, &g_fixed);
+    ISYS_CHECK(g_allocations == before);
+    ISYS_CHECK(g_list.nrOfTargets == MAX_TARGETS);
+}
+
+static void testNonBlockingReceive(iSYS4001 &radar)
+{
+    ISYS_CHECK(radar.setNonBlocking(true) == ERR_OK);
+
+    const unsigned long before = g_allocations;
+    for (unsigned i = 0; i < RECEIVES; i++)
+    {
+        ISYS_CHECK(radar.getTargetList32(&g_list, 0x80, 300) == ERR_TRANSACTION_PENDING);
+        while (radar.poll() == ISYS_TRANSACTION_PENDING)
+        {
+        }
+        ISYS_CHECK(radar.getTransactionResult() == ERR_OK);
+    }
+    ISYS_CHECK(g_allocations == before);
+
+    ISYS_CHECK(radar.setNonBlocking(false) == ERR_OK);
+}
+
+static void testStreamReceive(iSYS4001 &radar)
+{
+    const unsigned long before = g_allocations;
+    ISYS_CHECK(radar.startTargetListStream32(&g_arrays, 0x80, 300) == ERR_OK);
+
+    unsigned received = 0;
+    while (received < RECEIVES)
+    {
+        if (radar.poll() == ISYS_TRANSACTION_COMPLETE)
+        {
+            ISYS_CHECK(radar.getTransactionResult() == ERR_OK);
+            received++;
+        }
+    }
+
+    ISYS_CHECK(radar.stopTargetListStream() == ERR_OK);
+    while (radar.poll() == ISYS_TRANSACTION_PENDING)
+    {
+    }
+    ISYS_CHECK(g_allocations == before);
+}
+
+int main()
+{
+    iSYSSimulatorLink link;
+    link.simulator().setScenario(ISYS_SCENARIO_MOVING, MAX_TARGETS);
+    iSYS4001 radar(link);
+
+    // Only the receives themselves are measured
+    ISYS_CHECK(radar.getTargetList32(&g_list, 0x80, 300) == ERR_OK);
+
+    testBlockingReceive(radar);
+    testNonBlockingReceive(radar);
+    testStreamReceive(radar);
+
+    return ISYS_TEST_EXIT_CODE();
+}
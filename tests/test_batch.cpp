@@ -0,0 +1,235 @@
+/*
+ * Pipelined parameter batches under lost and damaged responses
+ *
+ * GET responses and SET acknowledgements carry no parameter id. Whatever the link
+ * loses, readConfiguration() may only mark values valid that the device holds, and
+ * iSYS_setOutputConfig() may only report fields as written (and cache them) that
+ * the device applied. Checked against the simulator's parameter state over many
+ * fault patterns.
+ */
+
+#include "iSYS4001.h"
+#include "iSYSSimulatorLink.h"
+#include "iSYSTest.h"
+
+#include <math.h>
+#include <string.h>
+
+// Fault patterns (simulator seeds) per test
+#define SEEDS (60)
+
+// Every bit of iSYSConfigurationSnapshot_t::valid
+#define SNAPSHOT_ALL_VALUES ((ISYS_SNAPSHOT_DEVICE_ADDRESS_BIT << 1) - 1)
+
+// Velocity limits are converted to the device's m/s format, so they read back rounded
+#define VALUE_TOLERANCE (1.0f)
+
+static iSYSOutputConfig_t outputConfig(uint16_t offset)
+{
+    iSYSOutputConfig_t config;
+    config.rangeMin = (uint16_t)(1 + offset);
+    config.rangeMax = (uint16_t)(100 + offset);
+    config.velocityMin = (uint16_t)(3 + offset);
+    config.velocityMax = (uint16_t)(200 + offset);
+    config.signalMin = (uint16_t)(5 + offset);
+    config.signalMax = (uint16_t)(150 + offset);
+    config.direction = (offset & 1) ? ISYS_TARGET_DIRECTION_APPROACHING : ISYS_TARGET_DIRECTION_RECEDING;
+    config.filterType = (offset & 1) ? ISYS_OUTPUT_FILTER_MEDIAN : ISYS_OUTPUT_FILTER_MIN;
+    config.signalFilter = (offset & 1) ? ISYS_RANGE_RADIAL : ISYS_VELOCITY_RADIAL;
+    return config;
+}
+
+static bool fieldMatches(const iSYSOutputSnapshot_t *snapshot, const iSYSOutputConfig_t *config, uint8_t field)
+{
+    const float values[6] = {snapshot->rangeMin, snapshot->rangeMax, snapshot->velocityMin,
+                             snapshot->velocityMax, snapshot->signalMin, snapshot->signalMax};
+    const uint16_t expected[6] = {config->rangeMin, config->rangeMax, config->velocityMin,
+                                  config->velocityMax, config->signalMin, config->signalMax};
+
+    switch (field)
+    {
+    case ISYS_CONFIG_DIRECTION:
+        return snapshot->direction == config->direction;
+    case ISYS_CONFIG_FILTER_TYPE:
+        return snapshot->filterType == config->filterType;
+    case ISYS_CONFIG_SIGNAL_FILTER:
+        return snapshot->signalFilter == config->signalFilter;
+    default:
+        return fabsf(values[field] - (float)expected[field]) < VALUE_TOLERANCE;
+    }
+}
+
+static iSYSSimulatorFaults_t lossyFaults()
+{
+    iSYSSimulatorFaults_t faults;
+    memset(&faults, 0, sizeof(faults));
+    faults.latency = 300;
+    faults.jitter = 100;
+    faults.silenceRate = 0.05f;
+    faults.corruptRate = 0.05f;
+    faults.dropRate = 0.002f;
+    return faults;
+}
+
+static void configureOutputs(iSYS4001 &radar)
+{
+    iSYSResult_t results[ISYS_CONFIG_FIELD_COUNT];
+    for (uint8_t output = 0; output < 3; output++)
+    {
+        const iSYSOutputConfig_t config = outputConfig(output);
+        ISYS_CHECK(radar.iSYS_setOutputConfig((iSYSOutputNumber_t)(ISYS_OUTPUT_1 + output), &config, results, 0x80, 300) == ERR_OK);
+    }
+}
+
+static void testCleanLink()
+{
+    iSYSSimulatorLink link;
+    iSYS4001 radar(link);
+    configureOutputs(radar);
+
+    iSYSConfigurationSnapshot_t snapshot;
+    ISYS_CHECK(radar.readConfiguration(&snapshot, 0x80, 600) == ERR_OK);
+    ISYS_CHECK(snapshot.valid == SNAPSHOT_ALL_VALUES);
+    ISYS_CHECK(snapshot.deviceAddress == 0x80);
+
+    for (uint8_t output = 0; output < 3; output++)
+    {
+        const iSYSOutputConfig_t config = outputConfig(output);
+        for (uint8_t field = 0; field < ISYS_CONFIG_FIELD_COUNT; field++)
+        {
+            ISYS_CHECK(fieldMatches(&snapshot.outputs[output], &config, field));
+        }
+    }
+}
+
+static void testReadUnderLostResponses()
+{
+    unsigned validValues = 0;
+    unsigned missingValues = 0;
+
+    for (uint32_t seed = 1; seed <= SEEDS; seed++)
+    {
+        iSYSSimulatorLink link;
+        iSYS4001 radar(link);
+        iSYSParameterCache_t cache;
+        ISYS_CHECK(radar.setParameterCache(&cache, 0x80) == ERR_OK);
+        configureOutputs(radar);
+
+        link.simulator().setSeed(seed * 2654435761u);
+        link.simulator().setFaults(lossyFaults());
+
+        for (unsigned read = 0; read < 5; read++)
+        {
+            iSYSConfigurationSnapshot_t snapshot;
+            memset(&snapshot, 0xA5, sizeof(snapshot));
+            const iSYSResult_t res = radar.readConfiguration(&snapshot, 0x80, 300);
+            ISYS_CHECK((res == ERR_OK) == (snapshot.valid == SNAPSHOT_ALL_VALUES));
+
+            for (uint8_t output = 0; output < 3; output++)
+            {
+                const iSYSOutputConfig_t config = outputConfig(output);
+                for (uint8_t field = 0; field < ISYS_CONFIG_FIELD_COUNT; field++)
+                {
+                    if (snapshot.valid & ISYS_SNAPSHOT_OUTPUT_BIT(ISYS_OUTPUT_1 + output, field))
+                    {
+                        ISYS_CHECK(fieldMatches(&snapshot.outputs[output], &config, field));
+                        validValues++;
+                    }
+                    else
+                    {
+                        missingValues++;
+                    }
+                }
+            }
+            if (snapshot.valid & ISYS_SNAPSHOT_DEVICE_ADDRESS_BIT)
+            {
+                ISYS_CHECK(snapshot.deviceAddress == 0x80);
+            }
+        }
+
+        // Values cached by the batches answer getters; they must be the device's
+        link.simulator().setFaults(iSYSSimulatorFaults_t());
+        for (uint8_t output = 0; output < 3; output++)
+        {
+            const iSYSOutputConfig_t config = outputConfig(output);
+            float value;
+            ISYS_CHECK(radar.iSYS_getOutputRangeMax((iSYSOutputNumber_t)(ISYS_OUTPUT_1 + output), &value, 0x80, 300) == ERR_OK);
+            ISYS_CHECK(fabsf(value - (float)config.rangeMax) < VALUE_TOLERANCE);
+            ISYS_CHECK(radar.iSYS_getOutputSignalMin((iSYSOutputNumber_t)(ISYS_OUTPUT_1 + output), &value, 0x80, 300) == ERR_OK);
+            ISYS_CHECK(fabsf(value - (float)config.signalMin) < VALUE_TOLERANCE);
+        }
+    }
+
+    // The faults cost values, but the windows before a loss were still kept
+    ISYS_CHECK(validValues > 0);
+    ISYS_CHECK(missingValues > 0);
+}
+
+static void testWriteUnderLostAcknowledgements()
+{
+    unsigned written = 0;
+    unsigned failed = 0;
+
+    for (uint32_t seed = 1; seed <= SEEDS; seed++)
+    {
+        iSYSSimulatorLink link;
+        iSYS4001 radar(link);
+        iSYSParameterCache_t cache;
+        ISYS_CHECK(radar.setParameterCache(&cache, 0x80) == ERR_OK);
+        configureOutputs(radar);
+
+        link.simulator().setSeed(seed * 2654435761u);
+        link.simulator().setFaults(lossyFaults());
+
+        const iSYSOutputConfig_t previous = outputConfig(0);
+        const iSYSOutputConfig_t config = outputConfig(11);
+        iSYSResult_t results[ISYS_CONFIG_FIELD_COUNT];
+        radar.iSYS_setOutputConfig(ISYS_OUTPUT_1, &config, results, 0x80, 300);
+
+        // Read the device state back over a clean link, without the cache
+        link.simulator().setFaults(iSYSSimulatorFaults_t());
+        iSYS4001 auditor(link);
+        iSYSConfigurationSnapshot_t device;
+        ISYS_CHECK(auditor.readConfiguration(&device, 0x80, 600) == ERR_OK);
+
+        for (uint8_t field = 0; field < ISYS_CONFIG_FIELD_COUNT; field++)
+        {
+            if (results[field] == ERR_OK)
+            {
+                // Reported as written: the device holds it
+                ISYS_CHECK(fieldMatches(&device.outputs[0], &config, field));
+                written++;
+            }
+            else
+            {
+                // Unconfirmed: the device holds either value
+                ISYS_CHECK(fieldMatches(&device.outputs[0], &config, field) || fieldMatches(&device.outputs[0], &previous, field));
+                failed++;
+            }
+        }
+
+        // Cached entries answer getters and must agree with the device
+        float value;
+        ISYS_CHECK(radar.iSYS_getOutputRangeMin(ISYS_OUTPUT_1, &value, 0x80, 300) == ERR_OK);
+        ISYS_CHECK(fabsf(value - device.outputs[0].rangeMin) < VALUE_TOLERANCE);
+        ISYS_CHECK(radar.iSYS_getOutputVelocityMax(ISYS_OUTPUT_1, &value, 0x80, 300) == ERR_OK);
+        ISYS_CHECK(fabsf(value - device.outputs[0].velocityMax) < VALUE_TOLERANCE);
+        ISYS_CHECK(radar.iSYS_getOutputSignalMax(ISYS_OUTPUT_1, &value, 0x80, 300) == ERR_OK);
+        ISYS_CHECK(fabsf(value - device.outputs[0].signalMax) < VALUE_TOLERANCE);
+        iSYSOutput_filter_t filterType;
+        ISYS_CHECK(radar.iSYS_getOutputFilterType(ISYS_OUTPUT_1, &filterType, 0x80, 300) == ERR_OK);
+        ISYS_CHECK(filterType == device.outputs[0].filterType);
+    }
+
+    ISYS_CHECK(written > 0);
+    ISYS_CHECK(failed > 0);
+}
+
+int main()
+{
+    testCleanLink();
+    testReadUnderLostResponses();
+    testWriteUnderLostAcknowledgements();
+
+    return ISYS_TEST_EXIT_CODE();
+}
@@ -0,0 +1,126 @@
+/*
+ * Clipping frames (target count 0xFF)
+ *
+ * The sensor reports an overloaded receiver with a target list of count 0xFF and
+ * no records. Every list type must then read as clipping with no targets, blocking
+ * and streamed, and the next regular frame must report its targets again.
+ */
+
+#include "iSYS4001.h"
+#include "iSYSSimulatorLink.h"
+#include "iSYSTest.h"
+
+#include <string.h>
+
+// Static targets the simulator reports when it does not clip
+#define TARGETS (8)
+
+static iSYSSimulatorFaults_t clipFaults(float clipRate)
+{
+    iSYSSimulatorFaults_t faults;
+    memset(&faults, 0, sizeof(faults));
+    faults.latency = 500;
+    faults.clipRate = clipRate;
+    return faults;
+}
+
+template <typename TargetList>
+static void checkClipped(const TargetList *targetList)
+{
+    ISYS_CHECK(targetList->clippingFlag == 1);
+    ISYS_CHECK(targetList->nrOfTargets == 0);
+    ISYS_CHECK(targetList->outputNumber == ISYS_OUTPUT_1);
+}
+
+template <typename TargetList>
+static void checkRegular(const TargetList *targetList)
+{
+    ISYS_CHECK(targetList->clippingFlag == 0);
+    ISYS_CHECK(targetList->nrOfTargets == TARGETS);
+}
+
+template <typename TargetList>
+static void testBlocking(bool zeroFill)
+{
+    iSYSSimulatorLink link;
+    link.simulator().setScenario(ISYS_SCENARIO_STATIC, TARGETS);
+    iSYS4001 radar(link);
+    radar.setTargetListZeroFill(zeroFill);
+    static TargetList targetList;
+
+    // A regular list first, so a clipping frame cannot pass by leaving it untouched
+    ISYS_CHECK(radar.getTargetList32(&targetList, 0x80, 300) == ERR_OK);
+    checkRegular(&targetList);
+
+    link.simulator().setFaults(clipFaults(1.0f));
+    ISYS_CHECK(radar.getTargetList16(&targetList, 0x80, 300) == ERR_OK);
+    checkClipped(&targetList);
+    ISYS_CHECK(radar.getTargetList32(&targetList, 0x80, 300) == ERR_OK);
+    checkClipped(&targetList);
+
+    link.simulator().setFaults(clipFaults(0.0f));
+    ISYS_CHECK(radar.getTargetList16(&targetList, 0x80, 300) == ERR_OK);
+    checkRegular(&targetList);
+
+    iSYSLinkStats_t stats;
+    ISYS_CHECK(radar.getLinkStats(&stats) == ERR_OK);
+    ISYS_CHECK(stats.clippingEvents == 2);
+}
+
+template <typename TargetList>
+static void testStream()
+{
+    iSYSSimulatorLink link;
+    link.simulator().setScenario(ISYS_SCENARIO_STATIC, TARGETS);
+    link.simulator().setSeed(0x5EED0001u);
+    link.simulator().setFaults(clipFaults(0.3f));
+    iSYS4001 radar(link);
+    static TargetList targetList;
+
+    ISYS_CHECK(radar.startTargetListStream32(&targetList, 0x80, 300) == ERR_OK);
+
+    unsigned clipped = 0;
+    unsigned regular = 0;
+    while (clipped + regular < 200)
+    {
+        if (radar.poll() != ISYS_TRANSACTION_COMPLETE)
+        {
+            continue;
+        }
+        ISYS_CHECK(radar.getTransactionResult() == ERR_OK);
+        if (targetList.clippingFlag)
+        {
+            checkClipped(&targetList);
+            clipped++;
+        }
+        else
+        {
+            checkRegular(&targetList);
+            regular++;
+        }
+    }
+
+    ISYS_CHECK(radar.stopTargetListStream() == ERR_OK);
+    while (radar.poll() == ISYS_TRANSACTION_PENDING)
+    {
+    }
+
+    // Both kinds alternate, including clipping frames right after regular ones
+    ISYS_CHECK(clipped > 20);
+    ISYS_CHECK(regular > 20);
+    ISYS_CHECK(link.simulator().getStats()->clipped >= clipped);
+}
+
+int main()
+{
+    testBlocking<iSYSTargetList_t>(false);
+    testBlocking<iSYSTargetList_t>(true);
+    testBlocking<iSYSTargetArrays_t>(false);
+    testBlocking<iSYSTargetListFixed_t>(false);
+
+    testStream<iSYSTargetList_t>();
+    testStream<iSYSTargetArrays_t>();
+    testStream<iSYSTargetListFixed_t>();
+
+    return ISYS_TEST_EXIT_CODE();
+}
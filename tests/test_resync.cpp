@@ -0,0 +1,116 @@
+/*
+ * Frame parser resynchronisation on a noisy link
+ *
+ * Line noise, partial frames, lost bytes and wrong checksums must never turn into
+ * a wrong target list: a damaged response fails its own request, and the next
+ * request succeeds again without any reset by the application.
+ */
+
+#include "iSYS4001.h"
+#include "iSYSSimulatorLink.h"
+#include "iSYSTest.h"
+
+#include <string.h>
+
+// Static targets the simulator reports
+#define TARGETS (8)
+
+static iSYSSimulatorFaults_t linkFaults(float dropRate, float corruptRate)
+{
+    iSYSSimulatorFaults_t faults;
+    memset(&faults, 0, sizeof(faults));
+    faults.latency = 500;
+    faults.jitter = 200;
+    faults.dropRate = dropRate;
+    faults.corruptRate = corruptRate;
+    return faults;
+}
+
+static void testGarbageBeforeResponse()
+{
+    iSYSSimulatorLink link;
+    link.simulator().setScenario(ISYS_SCENARIO_STATIC, TARGETS);
+    iSYS4001 radar(link);
+    iSYSTargetList_t targetList;
+
+    // Stray bytes, a start delimiter with mismatching lengths and a long-frame start
+    static const uint8_t noise[] = {0x00, 0x55, 0x68, 0x12, 0x16, 0x68, 0xA2, 0x16};
+    link.inject(noise, sizeof(noise));
+    ISYS_CHECK(radar.getTargetList16(&targetList, 0x80, 300) == ERR_OK);
+    ISYS_CHECK(targetList.nrOfTargets == TARGETS);
+
+    link.inject(noise, sizeof(noise));
+    ISYS_CHECK(radar.getTargetList32(&targetList, 0x80, 300) == ERR_OK);
+    ISYS_CHECK(targetList.nrOfTargets == TARGETS);
+
+    iSYSLinkStats_t stats;
+    ISYS_CHECK(radar.getLinkStats(&stats) == ERR_OK);
+    ISYS_CHECK(stats.resyncBytes > 0);
+}
+
+static void testPartialFrameBeforeResponse()
+{
+    iSYSSimulatorLink link;
+    link.simulator().setScenario(ISYS_SCENARIO_STATIC, TARGETS);
+    iSYS4001 radar(link);
+    iSYSTargetList_t targetList;
+
+    // The head of a GET response whose tail was lost; the parser takes the next bytes for it
+    static const uint8_t head[] = {0x68, 0x05, 0x05, 0x68, 0x01, 0x80};
+    link.inject(head, sizeof(head));
+    ISYS_CHECK(radar.getTargetList16(&targetList, 0x80, 300) == ERR_OK);
+    ISYS_CHECK(targetList.nrOfTargets == TARGETS);
+    ISYS_CHECK(targetList.clippingFlag == 0);
+}
+
+static void testFaultyLink(float dropRate, float corruptRate, uint32_t seed)
+{
+    iSYSSimulatorLink link;
+    link.simulator().setScenario(ISYS_SCENARIO_STATIC, TARGETS);
+    link.simulator().setSeed(seed);
+    link.simulator().setFaults(linkFaults(dropRate, corruptRate));
+    iSYS4001 radar(link);
+    iSYSTargetList_t targetList;
+
+    unsigned failed = 0;
+    for (unsigned i = 0; i < 300; i++)
+    {
+        const iSYSResult_t res = (i & 1) ? radar.getTargetList32(&targetList, 0x80, 100)
+                                         : radar.getTargetList16(&targetList, 0x80, 100);
+        if (res == ERR_OK)
+        {
+            // A list that passed the checks is the one the simulator sent
+            ISYS_CHECK(targetList.nrOfTargets == TARGETS);
+            ISYS_CHECK(targetList.clippingFlag == 0);
+        }
+        else
+        {
+            ISYS_CHECK(res == ERR_FRAME_INCOMPLETE || res == ERR_INVALID_CHECKSUM ||
+                       res == ERR_COMMAND_RX_FRAME_DAMAGED || res == ERR_COMMAND_NO_DATA_RECEIVED);
+            failed++;
+        }
+    }
+
+    // The faults hit, but most requests still went through
+    ISYS_CHECK(failed > 0);
+    ISYS_CHECK(failed < 150);
+
+    // Nothing is left over that breaks the clean link
+    link.simulator().setFaults(linkFaults(0.0f, 0.0f));
+    for (unsigned i = 0; i < 10; i++)
+    {
+        ISYS_CHECK(radar.getTargetList32(&targetList, 0x80, 100) == ERR_OK);
+        ISYS_CHECK(targetList.nrOfTargets == TARGETS);
+    }
+}
+
+int main()
+{
+    testGarbageBeforeResponse();
+    testPartialFrameBeforeResponse();
+    testFaultyLink(0.001f, 0.0f, 0x5EED0002u);
+    testFaultyLink(0.0f, 0.1f, 0x5EED0003u);
+    testFaultyLink(0.0005f, 0.05f, 0x5EED0004u);
+
+    return ISYS_TEST_EXIT_CODE();
+}